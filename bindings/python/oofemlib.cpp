@@ -651,6 +651,9 @@ void pyclass_OOFEMTXTDataReader()
 /*****************************************************
 * Domain
 *****************************************************/
+int (Domain::*createDofManagers_1)(const std::string&, const IntArray&, const FloatMatrix&, const std::string&) = &Domain::createDofManagers;
+int (Domain::*createElements_1)(const std::string&, const IntArray&, const IntArray&, const std::string&) = &Domain::createElements;
+
 void pyclass_Domain()
 {
     class_<Domain, boost::noncopyable>("Domain", init<int, int, EngngModel* >())
@@ -698,6 +701,8 @@ void pyclass_Domain()
 
         .def("setDofManager", &Domain::py_setDofManager)
         .def("setElement", &Domain::py_setElement)
+        .def("createDofManagers", createDofManagers_1, (bp::arg("type"), bp::arg("labels"), bp::arg("coords"), bp::arg("fields")=""))
+        .def("createElements", createElements_1, (bp::arg("type"), bp::arg("labels"), bp::arg("nodes"), bp::arg("fields")=""))
         .def("setCrossSection", &Domain::py_setCrossSection)
         .def("setMaterial", &Domain::py_setMaterial)
         .def("setBoundaryCondition", &Domain::py_setBoundaryCondition)
@@ -46,6 +46,7 @@ class FloatMatrix;
 class Element;
 class DofManager;
 class TimeStep;
+class Domain;
 class NodalLoad;
 class BodyLoad;
 class BoundaryLoad;
@@ -69,6 +70,8 @@ public:
     virtual void vectorFromEdgeLoad(FloatArray &vec, Element &element, EdgeLoad *load, int edge, TimeStep *tStep, ValueModeType mode) const;
     virtual void vectorFromNodeLoad(FloatArray &vec, DofManager &dman, NodalLoad *load, TimeStep *tStep, ValueModeType mode) const;
     virtual void assembleFromActiveBC(FloatArray &answer, ActiveBoundaryCondition &bc, TimeStep* tStep, ValueModeType mode, const UnknownNumberingScheme &s, FloatArray *eNorms) const;
+    /// Called before the element contributions of given domain are assembled, outside of parallel regions. Default implementation does nothing.
+    virtual void updateBeforeAssembly(Domain &domain, TimeStep *tStep) const { }
 
     /// Default implementation takes all the DOF IDs
     virtual void locationFromElement(IntArray &loc, Element &element, const UnknownNumberingScheme &s, IntArray *dofIds = nullptr) const;
@@ -88,6 +91,8 @@ public:
     virtual void matrixFromSurfaceLoad(FloatMatrix &mat, Element &element, SurfaceLoad *load, int boundary, TimeStep *tStep) const;
     virtual void matrixFromEdgeLoad(FloatMatrix &mat, Element &element, EdgeLoad *load, int edge, TimeStep *tStep) const;
     virtual void assembleFromActiveBC(SparseMtrx &k, ActiveBoundaryCondition &bc, TimeStep* tStep, const UnknownNumberingScheme &s_r, const UnknownNumberingScheme &s_c) const;
+    /// Called before the element contributions of given domain are assembled, outside of parallel regions. Default implementation does nothing.
+    virtual void updateBeforeAssembly(Domain &domain, TimeStep *tStep) const { }
 
     virtual void locationFromElement(IntArray &loc, Element &element, const UnknownNumberingScheme &s, IntArray *dofIds = nullptr) const;
     virtual void locationFromElementNodes(IntArray &loc, Element &element, const IntArray &bNodes, const UnknownNumberingScheme &s, IntArray *dofIds = nullptr) const;
@@ -106,6 +111,8 @@ public:
     void vectorFromSurfaceLoad(FloatArray &vec, Element &element, SurfaceLoad *load, int boundary, TimeStep *tStep, ValueModeType mode) const override;
     void vectorFromEdgeLoad(FloatArray &vec, Element &element, EdgeLoad *load, int edge, TimeStep *tStep, ValueModeType mode) const override;
     void assembleFromActiveBC(FloatArray &answer, ActiveBoundaryCondition &bc, TimeStep* tStep, ValueModeType mode, const UnknownNumberingScheme &s, FloatArray *eNorms) const override;
+    /// Lets the materials evaluate their integration points before the internal forces are assembled.
+    void updateBeforeAssembly(Domain &domain, TimeStep *tStep) const override;
 };
 
 /**
@@ -196,6 +203,8 @@ public:
     void matrixFromSurfaceLoad(FloatMatrix &mat, Element &element, SurfaceLoad *load, int boundary, TimeStep *tStep) const override;
     void matrixFromEdgeLoad(FloatMatrix &mat, Element &element, EdgeLoad *load, int edge, TimeStep *tStep) const override;
     void assembleFromActiveBC(SparseMtrx &k, ActiveBoundaryCondition &bc, TimeStep* tStep, const UnknownNumberingScheme &s_r, const UnknownNumberingScheme &s_c) const override;
+    /// Lets the materials evaluate their tangents before the matrix is assembled.
+    void updateBeforeAssembly(Domain &domain, TimeStep *tStep) const override;
 };
 
 
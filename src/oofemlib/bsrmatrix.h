@@ -0,0 +1,146 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef bsrmatrix_h
+#define bsrmatrix_h
+
+#include "sparsemtrx.h"
+#include "intarray.h"
+#include "floatarray.h"
+
+#include <vector>
+
+#define _IFT_BSRMatrix_Name "bsr"
+
+namespace oofem {
+class Domain;
+
+/**
+ * Sparse matrix stored in block compressed row format.
+ * The blocks are given by dof managers: each dof manager with active equations owns a block row
+ * (dof managers with more dofs than the block size own several), the block size is the most frequent
+ * number of dofs of a dof manager. Equations without a dof manager are grouped into blocks in order.
+ * Slots of constrained (or missing) dofs are kept as padding; they have unit diagonal,
+ * so that the diagonal blocks are regular, and they never enter the products.
+ *
+ * Compared to scalar compressed formats, only one column index is stored per block
+ * (instead of one per entry), the element matrices are assembled block by block
+ * and the block products run through fixed size kernels, which the compiler can unroll and vectorize.
+ * The whole (unsymmetric) matrix is stored.
+ */
+class OOFEM_EXPORT BSRMatrix : public SparseMtrx
+{
+protected:
+    /// Block size.
+    int bsize;
+    /// Number of block rows (and columns).
+    int nBlocks;
+    /// Positions of block rows in blockCol (nBlocks+1 elements).
+    IntArray blockPtr;
+    /// Block column indices, sorted in each block row.
+    IntArray blockCol;
+    /// Positions of diagonal blocks in blockCol.
+    IntArray diagBlock;
+    /// Values, each block is stored row-wise (bsize*bsize values per block).
+    FloatArray val;
+    /// Block of each equation.
+    IntArray eqBlock;
+    /// Slot within the block of each equation.
+    IntArray eqSlot;
+    /// Equation of each slot (nBlocks*bsize elements), -1 for padding.
+    IntArray slotEq;
+    /// Work vectors for products in blocked numbering.
+    mutable std :: vector< double >xb, yb;
+
+public:
+    /** Constructor. Before any operation an internal profile must be built.
+     * @see buildInternalStructure
+     */
+    BSRMatrix(int n = 0);
+    /// Copy constructor
+    BSRMatrix(const BSRMatrix & S);
+    /// Destructor
+    virtual ~BSRMatrix() { }
+
+    std::unique_ptr<SparseMtrx> clone() const override;
+    void times(const FloatArray &x, FloatArray &answer) const override;
+    void timesT(const FloatArray &x, FloatArray &answer) const override;
+    void times(const FloatMatrix &B, FloatMatrix &answer) const override;
+    void timesT(const FloatMatrix &B, FloatMatrix &answer) const override;
+    void times(double x) override;
+    void add(double x, SparseMtrx &m) override;
+    int buildInternalStructure(EngngModel *, int, const UnknownNumberingScheme &) override;
+    int assemble(const IntArray &loc, const FloatMatrix &mat) override;
+    int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
+    bool canBeFactorized() const override { return false; }
+    void zero() override;
+    double &at(int i, int j) override;
+    double at(int i, int j) const override;
+    bool isAllocatedAt(int i, int j) const override;
+    void toFloatMatrix(FloatMatrix &answer) const override;
+    void printStatistics() const override;
+    SparseMtrxType giveType() const override { return SMT_BSR; }
+    bool isAsymmetric() const override { return true; }
+    const char *giveClassName() const override { return "BSRMatrix"; }
+
+    /// Returns the block size.
+    int giveBlockSize() const { return bsize; }
+    /// Returns the number of block rows.
+    int giveNumberOfBlocks() const { return nBlocks; }
+    /// Returns the positions of block rows (0-based).
+    const IntArray &giveBlockRowPointers() const { return blockPtr; }
+    /// Returns the block column indices (0-based).
+    const IntArray &giveBlockColumns() const { return blockCol; }
+    /// Returns the positions of the diagonal blocks.
+    const IntArray &giveDiagonalBlocks() const { return diagBlock; }
+    /// Returns the block values.
+    const FloatArray &giveValues() const { return val; }
+    /// Returns the equation (0-based) of each slot, -1 for padding slots.
+    const IntArray &giveSlotEquations() const { return slotEq; }
+    /// Copies vector into blocked numbering (padding slots are zero).
+    void gather(const FloatArray &x, std :: vector< double > &answer) const;
+    /// Copies vector from blocked numbering.
+    void scatter(const std :: vector< double > &x, FloatArray &answer) const;
+
+protected:
+    /// Assigns equations to blocks and slots.
+    void buildBlockMap(Domain *domain, const UnknownNumberingScheme &s, int neq);
+    /// Returns the position of block (I,J) or -1 if not allocated.
+    int giveBlockIndex(int I, int J) const;
+    /// Sets unit diagonal of padding slots.
+    void setPaddingDiagonal();
+};
+} // end namespace oofem
+#endif // bsrmatrix_h
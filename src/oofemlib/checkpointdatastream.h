@@ -0,0 +1,160 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef checkpointdatastream_h
+#define checkpointdatastream_h
+
+#include "oofemcfg.h"
+#include "datastream.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace oofem {
+/**
+ * Data stream for context (checkpoint) files.
+ * Written data are collected in memory and stored in file in one shot when the stream is closed.
+ * The data are split into sections, marked by beginSection (typically the context of one component).
+ * The stream is stored either as a full checkpoint, or as a differential one, containing only
+ * the sections which differ from given full checkpoint (base). This is efficient when the state
+ * layout remains the same between checkpoints and only part of it changes (e.g. only some integration
+ * points are loaded inelastically). When the differential checkpoint would not be substantially smaller,
+ * the full one is written instead.
+ * When reading, the file (and the base file) is memory mapped and the sections are read directly from the mapping.
+ * Files written by FileDataStream (containing just the raw data) are recognized and can be read as well.
+ *
+ * The file starts with header containing the magic string "OOFEMCHK", the format version, the size
+ * of the stored data, the number of sections, the name of the base file (empty for full checkpoints)
+ * and the end offsets of the sections. The full checkpoint continues with the raw data, the differential one
+ * with the index of the base section reused by each section (or -1 if the section is stored) and the stored sections.
+ * The base file is looked up in the directory of the differential checkpoint.
+ */
+class OOFEM_EXPORT CheckpointDataStream : public DataStream
+{
+protected:
+    struct MappedFile;
+
+    /// File name.
+    std :: string filename;
+    /// Name of base (full) checkpoint for differential output, empty for full checkpoint.
+    std :: string baseFilename;
+    /// Output file, null in read mode or after closing.
+    FILE *stream;
+    /// Written data.
+    std :: vector< char >buffer;
+    /// Mapped file and base file (read mode).
+    std :: unique_ptr< MappedFile >file, baseFile;
+    /// Contiguous data (read mode) pointing to the mapped file, null for differential checkpoints.
+    const char *data;
+    /// End offsets of the sections.
+    std :: vector< std :: uint64_t >sectionEnds;
+    /// Data of sections of differential checkpoint (read mode), pointing to the mapped files.
+    std :: vector< const char * >sections;
+    /// Section containing the current reading position of differential checkpoint.
+    std :: size_t section;
+    /// Total size of data and current reading position.
+    std :: size_t size, position;
+
+public:
+    /**
+     * Opens checkpoint file.
+     * @param filename File name.
+     * @param write Write mode, otherwise the file is read.
+     * @param baseFilename Full checkpoint to which the written data are compared; if empty (or not a full checkpoint),
+     * full checkpoint is written. Ignored in read mode.
+     * @exception FileDataStream::CantOpen if the file (or base file of differential checkpoint) can not be opened.
+     */
+    CheckpointDataStream(std :: string filename, bool write, std :: string baseFilename = "");
+    /// Destructor, closes the stream.
+    virtual ~CheckpointDataStream();
+
+    /**
+     * Stores the written data in the file. Called automatically by destructor.
+     * @return Nonzero if successful.
+     */
+    int close();
+
+    /**
+     * Returns true if the checkpoint is differential. In write mode, the result is known after the stream is closed.
+     */
+    bool isDifferential() const { return !baseFilename.empty(); }
+
+    using DataStream :: read;
+    using DataStream :: write;
+
+    int read(int *data, int count) override { return this->readBytes(data, sizeof( int ) * count); }
+    int read(unsigned long *data, int count) override { return this->readBytes(data, sizeof( unsigned long ) * count); }
+    int read(long *data, int count) override { return this->readBytes(data, sizeof( long ) * count); }
+    int read(double *data, int count) override { return this->readBytes(data, sizeof( double ) * count); }
+    int read(char *data, int count) override { return this->readBytes(data, sizeof( char ) * count); }
+    int read(bool &data) override { return this->readBytes(& data, sizeof( bool ) ); }
+
+    int write(const int *data, int count) override { return this->writeBytes(data, sizeof( int ) * count); }
+    int write(const unsigned long *data, int count) override { return this->writeBytes(data, sizeof( unsigned long ) * count); }
+    int write(const long *data, int count) override { return this->writeBytes(data, sizeof( long ) * count); }
+    int write(const double *data, int count) override { return this->writeBytes(data, sizeof( double ) * count); }
+    int write(const char *data, int count) override { return this->writeBytes(data, sizeof( char ) * count); }
+    int write(bool data) override { return this->writeBytes(& data, sizeof( bool ) ); }
+
+    int givePackSizeOfInt(int count) override { return sizeof( int ) * count; }
+    int givePackSizeOfDouble(int count) override { return sizeof( double ) * count; }
+    int givePackSizeOfChar(int count) override { return sizeof( char ) * count; }
+    int givePackSizeOfBool(int count) override { return sizeof( bool ) * count; }
+    int givePackSizeOfLong(int count) override { return sizeof( long ) * count; }
+
+    void beginSection() override
+    {
+        if ( stream && buffer.size() > ( sectionEnds.empty() ? 0 : sectionEnds.back() ) ) {
+            sectionEnds.push_back( buffer.size() );
+        }
+    }
+
+protected:
+    int readBytes(void *answer, std :: size_t n);
+    int writeBytes(const void *values, std :: size_t n)
+    {
+        if ( !stream ) {
+            return 0;
+        }
+        const char *p = static_cast< const char * >(values);
+        buffer.insert(buffer.end(), p, p + n);
+        return 1;
+    }
+};
+} // end namespace oofem
+#endif // checkpointdatastream_h
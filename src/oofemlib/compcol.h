@@ -75,6 +75,8 @@
 #include "sparsemtrx.h"
 #include "intarray.h"
 
+#include <mutex>
+
 #define _IFT_CompCol_Name "csc"
 
 namespace oofem {
@@ -92,6 +94,14 @@ protected:
     int base;              // index base: offset of first element
     int nz;                // number of nonzeros
 
+    // row-wise access to the values, built on demand for the parallel products
+    mutable IntArray rowIndexPtr;    // positions of rows in rowIndexCol and rowIndexPos (dim_[0]+1 elements)
+    mutable IntArray rowIndexCol;    // column indices of row entries (nz_ elements)
+    mutable IntArray rowIndexPos;    // positions of row entries in val (nz_ elements)
+    mutable FloatArray rowIndexVal;  // copy of values in row order (nz_ elements)
+    mutable SparseMtrxVersionType rowIndexVersion; // matrix version of rowIndexVal
+    mutable std :: mutex rowIndexMutex; // serializes building of the row index by concurrent products
+
 public:
     /** Constructor. Before any operation an internal profile must be built.
      * @see buildInternalStructure
@@ -108,11 +118,14 @@ public:
     std::unique_ptr<SparseMtrx> clone() const override;
     void times(const FloatArray &x, FloatArray &answer) const override;
     void timesT(const FloatArray &x, FloatArray &answer) const override;
+    void times(const FloatMatrix &B, FloatMatrix &answer) const override;
+    void timesT(const FloatMatrix &B, FloatMatrix &answer) const override;
     void times(double x) override;
     int buildInternalStructure(EngngModel *, int, const UnknownNumberingScheme &s) override;
     int assemble(const IntArray &loc, const FloatMatrix &mat) override;
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
     bool canBeFactorized() const override { return false; }
+    bool supportsConcurrentAssembly() const override { return true; }
     void zero() override;
     double &at(int i, int j) override;
     double at(int i, int j) const override;
@@ -135,6 +148,16 @@ public:
     const int &col_ptr(int i) const { return colptr[i]; }
 
 protected:
+    /**
+     * Builds the row-wise index of the values (rowIndexPtr, rowIndexCol, rowIndexPos), if not yet available,
+     * and refreshes the row ordered copy of values if the matrix has changed since.
+     * Safe to call from concurrent products of the same matrix.
+     * The products by rows are free of write conflicts and can be computed in parallel.
+     */
+    void buildRowIndex() const;
+    /// Returns true if the products should run in parallel (more than one thread and large enough matrix).
+    bool useParallelProducts() const;
+
     /***********************************/
     /*  General access function (slow) */
     /***********************************/
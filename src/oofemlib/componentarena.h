@@ -0,0 +1,80 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef componentarena_h
+#define componentarena_h
+
+#include "oofemcfg.h"
+
+#include <cstddef>
+
+namespace oofem {
+/**
+ * Arena for a batch of components of the same type (dof managers or elements created from one run of input records).
+ * While the arena is active in the calling thread, the components allocated through allocate are placed consecutively
+ * in one contiguous chunk sized for the whole batch, instead of being allocated one by one.
+ * Components keep being owned and deleted individually; the chunk is released when the arena has been closed
+ * and the last of its components has been deleted.
+ *
+ * Requests of a different size than the first one (i.e. of another type), requests exceeding the batch size and
+ * requests made while no arena is active are served by the global allocator.
+ * Classes use the arena by defining their operator new and operator delete through allocate and deallocate.
+ */
+class OOFEM_EXPORT ComponentArena
+{
+protected:
+    struct Chunk;
+    /// Chunk of the batch, allocated at the first request.
+    Chunk *chunk;
+    /// Number of components in batch.
+    std :: size_t count;
+    /// Arena active before this one in the calling thread.
+    ComponentArena *previous;
+
+public:
+    /// Activates the arena for a batch of given number of components in calling thread.
+    ComponentArena(std :: size_t count);
+    /// Closes the arena, the components allocated in it stay valid.
+    ~ComponentArena();
+
+    ComponentArena(const ComponentArena &) = delete;
+    ComponentArena &operator = ( const ComponentArena & ) = delete;
+
+    /// Allocates memory for one component, in the arena active in calling thread if possible.
+    static void *allocate(std :: size_t bytes);
+    /// Releases memory allocated by allocate (from any thread).
+    static void deallocate(void *ptr) noexcept;
+};
+} // end namespace oofem
+#endif // componentarena_h
@@ -83,6 +83,14 @@ public:
      */
     virtual bool peakNext(const std :: string &keyword) { return false; }
 
+    /**
+     * Peak in advance at the run of records with the same keyword, which starts with the next record.
+     * Such runs (e.g. of nodes or elements of one type) are instanciated together.
+     * @param maxCount Maximum length of the run.
+     * @return Number of records in the run, at least one.
+     */
+    virtual int giveRunLength(int maxCount) { return 1; }
+
     /**
      * Allows to detach all data connections.
      */
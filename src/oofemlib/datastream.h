@@ -39,6 +39,8 @@
 
 #include <sstream>
 #include <cstdio>
+#include <cstring>
+#include <vector>
 #include <exception>
 #include <stdexcept>
 
@@ -124,6 +126,13 @@ public:
     virtual int givePackSizeOfBool(int count) = 0;
     virtual int givePackSizeOfLong(int count) = 0;
     //@}
+
+    /**
+     * Marks the beginning of a section of written data, typically the context of one component.
+     * Streams may use the marks to compare the data with previously written ones, the default
+     * implementation ignores them.
+     */
+    virtual void beginSection() { }
 };
 
 
@@ -176,5 +185,66 @@ public:
     int givePackSizeOfLong(int count) override;
 };
 
+
+/**
+ * Implementation of DataStream storing the data in memory.
+ * Written data are appended to the given buffer, reading starts at the beginning of the buffer.
+ * The buffer is owned by the caller, so that the stored state can outlive the stream.
+ */
+class OOFEM_EXPORT MemoryDataStream : public DataStream
+{
+protected:
+    /// Data buffer.
+    std :: vector< char > &buffer;
+    /// Current reading position.
+    std :: size_t position;
+
+public:
+    /// Constructor, takes the buffer to write to or read from.
+    MemoryDataStream(std :: vector< char > &buffer) : buffer(buffer), position(0) { }
+
+    using DataStream :: read;
+    using DataStream :: write;
+
+    int read(int *data, int count) override { return this->readBytes(data, sizeof( int ) * count); }
+    int read(unsigned long *data, int count) override { return this->readBytes(data, sizeof( unsigned long ) * count); }
+    int read(long *data, int count) override { return this->readBytes(data, sizeof( long ) * count); }
+    int read(double *data, int count) override { return this->readBytes(data, sizeof( double ) * count); }
+    int read(char *data, int count) override { return this->readBytes(data, sizeof( char ) * count); }
+    int read(bool &data) override { return this->readBytes(& data, sizeof( bool ) ); }
+
+    int write(const int *data, int count) override { return this->writeBytes(data, sizeof( int ) * count); }
+    int write(const unsigned long *data, int count) override { return this->writeBytes(data, sizeof( unsigned long ) * count); }
+    int write(const long *data, int count) override { return this->writeBytes(data, sizeof( long ) * count); }
+    int write(const double *data, int count) override { return this->writeBytes(data, sizeof( double ) * count); }
+    int write(const char *data, int count) override { return this->writeBytes(data, sizeof( char ) * count); }
+    int write(bool data) override { return this->writeBytes(& data, sizeof( bool ) ); }
+
+    int givePackSizeOfInt(int count) override { return sizeof( int ) * count; }
+    int givePackSizeOfDouble(int count) override { return sizeof( double ) * count; }
+    int givePackSizeOfChar(int count) override { return sizeof( char ) * count; }
+    int givePackSizeOfBool(int count) override { return sizeof( bool ) * count; }
+    int givePackSizeOfLong(int count) override { return sizeof( long ) * count; }
+
+protected:
+    int readBytes(void *answer, std :: size_t n)
+    {
+        if ( position + n > buffer.size() ) {
+            return 0;
+        }
+        if ( n ) {
+            std :: memcpy(answer, buffer.data() + position, n);
+        }
+        position += n;
+        return 1;
+    }
+    int writeBytes(const void *values, std :: size_t n)
+    {
+        const char *p = static_cast< const char * >(values);
+        buffer.insert(buffer.end(), p, p + n);
+        return 1;
+    }
+};
+
 } // end namespace oofem
 #endif // datastream_h
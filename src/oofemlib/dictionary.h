@@ -32,52 +32,65 @@
  *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+
 #ifndef dictionr_h
 #define dictionr_h
 
 #include "oofemcfg.h"
-#include "pair.h"
 #include "error.h"
 #include "contextioresulttype.h"
 #include "contextmode.h"
 
 #include <string>
+#include <vector>
 #include <iosfwd>
 
 namespace oofem {
 class DataStream;
 
 /**
- * This class implements a linked list whose entries are Pairs (see below).
+ * This class implements a dictionary of (integer key, value) pairs.
+ *
+ * Dictionaries are typically used by materials and cross sections for storing their parameters
+ * and by degrees of freedom for storing their unknowns. They hold only a few pairs, but they are
+ * searched very frequently (typically at every integration point). The keys and values are therefore
+ * stored in flat arrays, in the order of insertion, and the keys are searched linearly, which is
+ * for such small sizes faster than any tree or hash based lookup.
  *
- * Dictionaries are typically used by degrees of freedom for storing their unknowns.
- * A dictionary stores its pairs in a linked list form. It knows the first
- * pair (attribute 'first') of the list. It also knows the last one (attribute
- * 'last') in order to append an additional pair fast.
+ * References to values returned by add and at remain valid until a new pair is inserted.
  */
 class OOFEM_EXPORT Dictionary
 {
 protected:
-    /// First pair
-    Pair *first;
-    /// Last pair
-    Pair *last;
+    /// Keys of pairs.
+    std :: vector< int >keys;
+    /// Values of pairs.
+    std :: vector< double >values;
+
+    /// Returns the position of given key, -1 if not present.
+    int giveIndex(int aKey) const
+    {
+        for ( std :: size_t i = 0; i < keys.size(); i++ ) {
+            if ( keys [ i ] == aKey ) {
+                return ( int ) i;
+            }
+        }
+        return -1;
+    }
 
 public:
     /// Constructor, creates empty dictionary
-    Dictionary() : first(NULL), last(NULL) { }
-    /// Destructor
-    ~Dictionary();
+    Dictionary() : keys(), values() { }
 
     /// Clears the receiver.
     void clear();
     /**
-     * Adds a new Pair with given keyword and value into receiver.
+     * Adds a new pair with given keyword and value into receiver.
      * @param aKey key of new pair
      * @param value value of new pair
-     * @return New Pair with given keyword and value
+     * @return Reference to the value of the new pair.
      */
-    Pair *add(int aKey, double value);
+    double &add(int aKey, double value);
     /**
      * Returns the value of the pair which key is aKey.
      * If requested key doesn't exist, it is created with assigned value 0.
@@ -85,18 +98,28 @@ public:
      * @return Reference to value of pair with given key
      */
     double &at(int aKey);
+    /**
+     * Looks up the pair with given key.
+     * @param aKey Key for pair.
+     * @return Pointer to the value of pair with given key, NULL if receiver does not contain such pair.
+     */
+    const double *find(int aKey) const
+    {
+        int i = this->giveIndex(aKey);
+        return i < 0 ? nullptr : & values [ i ];
+    }
     /**
      * Checks if dictionary includes given key
      * @param aKey Dictionary key.
      * @return True if receiver contains pair with given key, otherwise false.
      */
-    bool includes(int aKey);
+    bool includes(int aKey) const { return this->giveIndex(aKey) >= 0; }
     /// Prints the receiver on screen.
     void printYourself();
     /// Formats itself as string.
     void formatAsString(std :: string &str);
     /// Returns number of pairs of receiver.
-    int giveSize();
+    int giveSize() const { return ( int ) keys.size(); }
 
     /**
      * Saves the receiver contends (state) to given stream.
@@ -46,6 +46,7 @@
 #include "contextioresulttype.h"
 #include "unknowntype.h"
 #include "chartype.h"
+#include "componentarena.h"
 
 ///@name Input fields for DofManager
 //@{
@@ -168,6 +169,10 @@ public:
     /// Destructor.
     virtual ~DofManager();
 
+    /// Dof managers created in one batch are placed consecutively in the batch arena (see ComponentArena).
+    static void *operator new(std :: size_t size) { return ComponentArena :: allocate(size); }
+    static void operator delete(void *ptr) { ComponentArena :: deallocate(ptr); }
+
     /**@name Dof management methods */
     //@{
     /**
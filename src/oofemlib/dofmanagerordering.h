@@ -0,0 +1,104 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef dofmanagerordering_h
+#define dofmanagerordering_h
+
+#include "oofemcfg.h"
+
+#include <vector>
+#include <cstddef>
+
+namespace oofem {
+class Domain;
+class DofManager;
+class TimeStep;
+
+/**
+ * Type of equation renumbering (order of dof managers in which the equations are numbered).
+ */
+enum RenumberingType {
+    RNT_Natural = 0,                   ///< Dof managers numbered in the order of input.
+    RNT_Sloan = 1,                     ///< Sloan profile and wavefront reduction (suitable for skyline).
+    RNT_MinimumDegree = 2,             ///< Approximate minimum degree.
+    RNT_GeometricNestedDissection = 3, ///< Nested dissection by coordinate bisection.
+    RNT_NestedDissection = 4,          ///< Nested dissection by level structures of the graph.
+    RNT_Best = 5,                      ///< The ordering with smallest predicted fill of all above.
+};
+
+/**
+ * Fill reducing ordering of dof managers of domain.
+ * The graph of dof managers (including the internal dof managers of elements and boundary conditions) is built
+ * from element connectivity and slave-master links. The orderings are evaluated on this graph
+ * (see GraphOrdering and SloanGraph); the predicted fill is the size of Cholesky factor with each dof manager
+ * contributing a block of its dofs.
+ */
+class OOFEM_EXPORT DofManagerOrdering
+{
+protected:
+    /// Domain.
+    Domain *domain;
+    /// Dof managers corresponding to graph vertices.
+    std :: vector< DofManager * >dmans;
+    /// Adjacency pointers of graph.
+    std :: vector< int >adjPtr;
+    /// Adjacent vertices.
+    std :: vector< int >adj;
+    /// Number of dofs of each vertex.
+    std :: vector< int >weights;
+    /// Coordinates of vertices (three per vertex, NaN if not available).
+    std :: vector< double >coords;
+
+public:
+    /// Constructor. Creates the graph of given domain.
+    DofManagerOrdering(Domain *d);
+
+    /**
+     * Computes the ordering of given type.
+     * @param type Type of ordering, RNT_Best evaluates all orderings and selects the one with smallest predicted fill.
+     * @param order Vertices (dof managers) in new order.
+     * @return Type of ordering used.
+     */
+    RenumberingType computeOrdering(RenumberingType type, std :: vector< int > &order) const;
+    /// Returns the predicted number of nonzeros in factor for given ordering.
+    std :: size_t givePredictedFill(const std :: vector< int > &order) const;
+    /// Numbers the equations of dof managers in given order.
+    void askNewEquationNumbers(const std :: vector< int > &order, TimeStep *tStep) const;
+
+    /// Returns the name of renumbering type.
+    static const char *giveTypeName(RenumberingType type);
+};
+} // end namespace oofem
+#endif // dofmanagerordering_h
@@ -41,9 +41,7 @@
 #include "intarray.h"
 #include "error.h"
 #include "bctracker.h"
-#ifdef __PARALLEL_MODE
- #include "entityrenumberingscheme.h"
-#endif
+#include "entityrenumberingscheme.h"
 
 #include <memory>
 #include <unordered_map>
@@ -85,6 +83,8 @@ class DofManager;
 class OutputManager;
 class EngngModel;
 class ConnectivityTable;
+class ElementColoring;
+class IPStateStore;
 class ErrorEstimator;
 class SpatialLocalizer;
 class NodalRecoveryModel;
@@ -98,6 +98,8 @@ class FractureManager;
 class oofegGraphicContext;
 class ProcessCommunicator;
 class ContactManager;
+class TimeStep;
+class FloatMatrix;
 /**
  * Class and object Domain. Domain contains mesh description, or if program runs in parallel then it contains
  * description of domain associated to particular processor or thread of execution. Generally, it contain and
@@ -156,6 +158,22 @@ private:
      * Provides connectivity information of current domain.
      */
     std :: unique_ptr< ConnectivityTable > connectivityTable;
+    /**
+     * Element colorings for conflict-free parallel element loops, one for each encountered element activation pattern.
+     * Built upon request and kept until the mesh changes, so that a coloring is never rebuilt while an element loop uses it.
+     */
+    std :: vector< std :: unique_ptr< ElementColoring > >elementColorings;
+    /// Coloring of all elements, regardless of their activation.
+    ElementColoring *allElementColoring;
+    /// Coloring returned by the last request with a time step, reused while the intrinsic time does not change.
+    ElementColoring *lastElementColoring;
+    /// Intrinsic time of the last coloring request with a time step.
+    double lastElementColoringTime;
+    /**
+     * Integration point state stores, indexed by material and cross section (element set) number.
+     * Created upon request by materials supporting them.
+     */
+    std :: map< std :: pair< int, int >, std :: unique_ptr< IPStateStore > >ipStateStores;
     /**
      * Spatial Localizer. It is build upon request.
      * Provides the spatial localization services.
@@ -172,6 +190,8 @@ private:
     bool axisymm;
     /// nodal recovery object associated to receiver.
     std :: unique_ptr< NodalRecoveryModel > smoother; ///@todo I don't see why this has to be stored, and there is only one? /Mikael
+    /// Nodal recovery models shared by export modules (one for each recovery model type).
+    std :: map< int, std :: unique_ptr< NodalRecoveryModel > >nodalRecoveryModels;
 
     std :: string mDomainType;
     /**
@@ -185,6 +205,12 @@ private:
      * because in case of multiple domains stateCounter should be kept independently for each domain.
      */
     StateCounterType nonlocalUpdateStateCounter;
+    /**
+     * Version of the model definition (nodal coordinates and material parameters).
+     * Incremented whenever nodes move or material parameters change, so quantities cached by elements
+     * (like characteristic matrices) can be invalidated.
+     */
+    StateCounterType modelVersion;
     /// XFEM Manager
     std :: unique_ptr< XfemManager > xfemManager;
 
@@ -476,6 +502,48 @@ public:
     /// Resizes the internal data structure to accommodate space for _newSize sets.
     void resizeSets(int _newSize);
 
+    /**
+     * Creates dof managers from the next records of given data reader and appends them to the domain.
+     * The records form a run of records of one type (see DataReader :: giveRunLength), the dof managers
+     * are allocated together in one arena. Used when the domain is read from input file.
+     * @param dr Data reader, positioned at the first record of the run.
+     * @param n Number of records in run.
+     * @return Local number of the first created dof manager.
+     */
+    int createDofManagers(DataReader &dr, int n);
+    /**
+     * Creates elements from the next records of given data reader and appends them to the domain.
+     * The records form a run of records of one type (see DataReader :: giveRunLength), the elements
+     * are allocated together in one arena. The element connectivity is left in terms of node labels.
+     * @param dr Data reader, positioned at the first record of the run.
+     * @param n Number of records in run.
+     * @return Local number of the first created element.
+     */
+    int createElements(DataReader &dr, int n);
+    /**
+     * Creates a batch of dof managers of the same type and appends them to the domain.
+     * All dof managers are initialized through one input record positioned at each of them in turn,
+     * so that input fields are processed as for records read from input file.
+     * @param type Dof manager type (record keyword).
+     * @param labels Labels (global numbers) of the new dof managers, positive and not used by other dof managers.
+     * @param coords Coordinates, i-th column belongs to i-th dof manager.
+     * @param fields Further fields common to all dof managers, in input file syntax.
+     * @return Local number of the first created dof manager.
+     */
+    int createDofManagers(const std :: string &type, const IntArray &labels, const FloatMatrix &coords, const std :: string &fields = "");
+    /**
+     * Creates a batch of elements of the same type and appends them to the domain.
+     * @param type Element type (record keyword).
+     * @param labels Labels (global numbers) of the new elements, positive and not used by other elements.
+     * @param nodes Node labels of all elements, nodes of i-th element are stored consecutively.
+     * The referenced dof managers must already exist.
+     * @param fields Further fields common to all elements (e.g. "mat 1 crosssect 1"), in input file syntax.
+     * @return Local number of the first created element.
+     */
+    int createElements(const std :: string &type, const IntArray &labels, const IntArray &nodes, const std :: string &fields = "");
+    /// Returns local number of dof manager or element with given label.
+    int giveLocalNumberOfLabel(int label, EntityRenumberingScheme ers);
+
     ///@note Needed for some of the boost-python bindings. NOTE: This takes ownership of the pointers, so it's actually completely unsafe.
     //@{
     void py_setDofManager(int i, DofManager *obj);
@@ -616,6 +684,43 @@ public:
      * Returns receiver's associated connectivity table.
      */
     ConnectivityTable *giveConnectivityTable();
+    /**
+     * Returns the coloring of receiver's elements, such that elements of the same color share no dof managers.
+     * Element loops scattering into nodal or global quantities can process each color concurrently without locking.
+     * Colorings are cached for each activation pattern of elements and discarded only when the mesh changes,
+     * so the returned reference stays valid while element loops run, even if another pattern is requested meanwhile.
+     * @param tStep Time step determining the active elements; all elements are colored if NULL.
+     * @see ElementColoring
+     */
+    const ElementColoring &giveElementColoring(TimeStep *tStep = nullptr);
+    /// Discards the cached element colorings; called whenever elements or dof managers change.
+    void clearElementColorings();
+
+protected:
+    /// Returns the cached coloring for given element activation pattern, building it if necessary.
+    ElementColoring *findElementColoring(const std :: vector< bool > &activity);
+
+public:
+    /**
+     * Returns the integration point state store for given material and element set, created on first request.
+     * The element set is identified by the number of cross section assigned to elements.
+     * Thread safe, the statuses can be created within parallel element loops.
+     * @param material Material number.
+     * @param set Cross section number.
+     * @param nVariables Number of variables per integration point.
+     * @see IPStateStore
+     */
+    IPStateStore *giveIPStateStore(int material, int set, int nVariables);
+    /**
+     * Starts the bulk update of integration point state stores of receiver at the end of solution step.
+     * Should be invoked before the elements are updated; the backed statuses then only mark their slots for update.
+     */
+    void beginIPStateStoresUpdate();
+    /**
+     * Updates the slots of integration point state stores marked by updated statuses, i.e. the slots of
+     * local and active elements. Should be invoked after the elements are updated.
+     */
+    void updateIPStateStores();
     /**
      * Returns receiver's associated spatial localizer.
      */
@@ -644,6 +749,13 @@ public:
      * @param destroyOld Determines if any preexisting smoother should be deleted.
      */
     void setSmoother(NodalRecoveryModel *newSmoother, bool destroyOld = true);
+    /**
+     * Returns the nodal recovery model of given type shared by all export modules of receiver.
+     * The model is created on first request. As it keeps the recovered values until the solution state changes,
+     * the same variables requested by several modules are recovered only once.
+     * @param type Type of nodal recovery model (see NodalRecoveryModel :: NodalRecoveryModelType).
+     */
+    NodalRecoveryModel *giveNodalRecoveryModel(int type);
 
 #ifdef __PARALLEL_MODE
     /**@name Domain transaction support methods.
@@ -702,6 +814,10 @@ public:
     StateCounterType giveNonlocalUpdateStateCounter() { return this->nonlocalUpdateStateCounter; }
     /// sets the value of nonlocalUpdateStateCounter
     void setNonlocalUpdateStateCounter(StateCounterType val) { this->nonlocalUpdateStateCounter = val; }
+    /// Returns the version of model definition (changed when nodes move or material parameters change).
+    StateCounterType giveModelVersion() const { return this->modelVersion; }
+    /// Marks the change of model definition (nodal coordinates or material parameters).
+    void incrementModelVersion() { this->modelVersion++; }
 
 private:
     void resolveDomainDofsDefaults(const char *);
@@ -710,6 +826,21 @@ private:
     std :: string errorInfo(const char *func) const;
 
 private:
+    /**
+     * Creates a run of dof managers from consecutive input records.
+     * @param n Number of records.
+     * @param giveRecord Gives i-th record of the run (0-based), the records are requested in order.
+     */
+    template< class RecordSource >
+    int createDofManagerRun(int n, RecordSource giveRecord);
+    /**
+     * Creates a run of elements from consecutive input records.
+     * @param n Number of records.
+     * @param giveRecord Gives i-th record of the run (0-based), the records are requested in order.
+     */
+    template< class RecordSource >
+    int createElementRun(int n, RecordSource giveRecord);
+
     /**
      * Construct map from an element's global number to
      * its place the element array.
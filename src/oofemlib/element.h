@@ -53,6 +53,7 @@
 #include "integrationrule.h"
 #include "dofiditem.h"
 #include "floatarray.h"
+#include "componentarena.h"
 
 #include <cstdio>
 #include <vector>
@@ -208,6 +209,10 @@ public:
     /// Virtual destructor.
     virtual ~Element();
 
+    /// Elements created in one batch are placed consecutively in the batch arena (see ComponentArena).
+    static void *operator new(std :: size_t size) { return ComponentArena :: allocate(size); }
+    static void operator delete(void *ptr) { ComponentArena :: deallocate(ptr); }
+
     /**@name Methods referring to code numbers */
     //@{
     /**
@@ -642,13 +647,13 @@ public:
      * Sets the material of receiver.
      * @param matIndx Index of new material.
      */
-    void setMaterial(int matIndx) { this->material = matIndx; }
+    void setMaterial(int matIndx);
         
 	/**
      * Sets the cross section model of receiver.
      * @param csIndx Index of new cross section.
      */
-    virtual void setCrossSection(int csIndx) { this->crossSection = csIndx; }
+    virtual void setCrossSection(int csIndx);
 
     /// @return Number of dofmanagers of receiver.
     virtual int giveNumberOfDofManagers() const { return numberOfDofMans; }
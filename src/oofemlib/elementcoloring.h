@@ -0,0 +1,110 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef elementcoloring_h
+#define elementcoloring_h
+
+#include "oofemcfg.h"
+#include "intarray.h"
+
+#include <vector>
+
+namespace oofem {
+class Domain;
+class TimeStep;
+
+/**
+ * Partitioning of domain elements into groups (colors), such that no two elements in the same
+ * color share any dof manager. Contributions of elements within one color can therefore be
+ * scattered into global vectors and sparse matrices concurrently, without locking.
+ *
+ * Coloring is computed using greedy first-fit algorithm in element order, so the result is
+ * deterministic and independent of number of threads used.
+ * Elements whose dof managers contain slave dofs are not colored, as their master dof managers
+ * can not be resolved reliably (they may belong to boundary conditions); they are collected into
+ * the last, dependent, color which has to be processed serially.
+ * Element internal dof managers are taken into account, so sharing them is safe.
+ *
+ * Without OpenMP support, the active elements are put into a single dependent color in their natural order,
+ * as there is no concurrency to exploit.
+ *
+ * The coloring is usually obtained from Domain::giveElementColoring, which caches one coloring for
+ * each activation pattern of elements until the mesh changes.
+ */
+class OOFEM_EXPORT ElementColoring
+{
+protected:
+    /// Element numbers of individual colors.
+    std :: vector< IntArray >colors;
+    /// Number of independent colors (the remaining colors have to be processed serially).
+    int nIndependentColors;
+    /// Activation state of elements the coloring was built for.
+    std :: vector< bool >activity;
+    /// Flag indicating built coloring.
+    bool built;
+
+public:
+    ElementColoring() : colors(), nIndependentColors(0), activity(), built(false) { }
+
+    /**
+     * Computes the activation state of elements of given domain.
+     * @param answer Activation flags of elements.
+     * @param d Domain to process.
+     * @param tStep Time step determining the activation; if NULL, all elements are considered active.
+     */
+    static void giveElementActivity(std :: vector< bool > &answer, Domain *d, TimeStep *tStep);
+    /**
+     * Computes the coloring of elements of given domain.
+     * @param d Domain to process.
+     * @param elementActivity Activation state of elements, only the active elements are colored.
+     */
+    void build(Domain *d, const std :: vector< bool > &elementActivity);
+    /// Returns the activation state of elements the receiver was built for.
+    const std :: vector< bool > &giveActivity() const { return activity; }
+    /// Resets the receiver to an empty state (forces rebuild).
+    void clear();
+
+    /// Returns number of colors.
+    int giveNumberOfColors() const { return (int)colors.size(); }
+    /// Returns the element numbers of i-th color (1-based).
+    const IntArray &giveColor(int i) const { return colors [ i - 1 ]; }
+    /**
+     * Returns true if the elements of i-th color share no dof managers,
+     * i.e. they can be processed concurrently.
+     */
+    bool isIndependent(int i) const { return i <= nIndependentColors; }
+};
+} // end namespace oofem
+#endif // elementcoloring_h
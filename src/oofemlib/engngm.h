@@ -57,6 +57,7 @@
 #include "parallelcontext.h"
 #include "exportmodulemanager.h"
 #include "initmodulemanager.h"
+#include "dofmanagerordering.h"
 
 #ifdef __PARALLEL_MODE
  #include "parallel.h"
@@ -69,8 +70,11 @@
 //@{
 #define _IFT_EngngModel_nsteps "nsteps"
 #define _IFT_EngngModel_contextoutputstep "contextoutputstep"
+#define _IFT_EngngModel_contextfullstep "contextfullstep" ///< Every n-th stored context is full, the others are differential
 #define _IFT_EngngModel_renumberFlag "renumber"
 #define _IFT_EngngModel_profileOpt "profileopt"
+#define _IFT_EngngModel_renumbering "renumbering" ///< Equation renumbering (0 - natural, 1 - Sloan, 2 - AMD, 3 - geometric ND, 4 - ND, 5 - best)
+#define _IFT_EngngModel_profiling "profiling" ///< Profiling mode (0 - off, 1 - summary, 2 - summary and trace)
 #define _IFT_EngngModel_nmsteps "nmsteps"
 #define _IFT_EngngModel_nonLinFormulation "nonlinform"
 #define _IFT_EngngModel_eetype "eetype"
@@ -219,8 +223,8 @@ protected:
     IntArray domainPrescribedNeqs;
     /// Renumbering flag (renumbers equations after each step, necessary if Dirichlet BCs change).
     bool renumberFlag;
-    /// Profile optimized numbering flag (using Sloan's algorithm).
-    bool profileOpt;
+    /// Type of equation renumbering (profile optimization, fill reducing ordering).
+    RenumberingType renumberingType;
     /// Equation numbering completed flag.
     int equationNumberingCompleted;
     /// Number of meta steps.
@@ -247,6 +251,12 @@ protected:
     /// Domain context output mode.
     ContextOutputMode contextOutputMode;
     int contextOutputStep;
+    /// Every contextFullStep-th stored context is written in full, the others only contain data changed since the last full one.
+    int contextFullStep;
+    /// Number of contexts stored since the last full one, including it.
+    int numberOfContextsSinceFull;
+    /// Last full context file, base of differential contexts.
+    std :: string lastFullContextFileName;
 
     /// Export module manager.
     ExportModuleManager exportModuleManager;
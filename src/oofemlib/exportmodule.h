@@ -42,6 +42,7 @@
 #include "set.h"
 
 #include <list>
+#include <functional>
 
 ///@name Input fields for export module
 //@{
@@ -128,6 +129,16 @@ public:
      * @param tStep time step.
      */
     void doForcedOutput(TimeStep *tStep) { doOutput(tStep, true); }
+    /**
+     * Writes the output in two phases. The data to export are copied into a snapshot on the calling
+     * (solver) thread, while the returned task only serializes the snapshot. The task can be run
+     * later, possibly by the export thread of ExportModuleManager, so it must not access the problem.
+     * Default implementation writes the output directly by doOutput and returns empty task.
+     * @param tStep Time step.
+     * @param forcedOutput If true, no testTimeStepOutput should be done.
+     * @return Task writing the snapshot, empty if nothing remains to be written.
+     */
+    virtual std :: function< void() >doDeferredOutput(TimeStep *tStep, bool forcedOutput = false);
     /**
      * Initializes receiver.
      * The init file messages should be printed.
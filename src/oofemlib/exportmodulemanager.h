@@ -38,15 +38,48 @@
 #include "modulemanager.h"
 #include "exportmodule.h"
 
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+///@name Input fields for ExportModuleManager
+//@{
+#define _IFT_ExportModuleManager_asyncexport "asyncexport"
+//@}
+
 namespace oofem {
 class EngngModel;
 
 /**
  * Class representing and implementing ExportModuleManager. It is attribute of EngngModel.
  * It manages the export output modules, which perform module - specific output operations.
+ *
+ * In asynchronous mode (asyncexport keyword of engineering model record gives the maximum number of pending outputs),
+ * the modules only snapshot the exported data on the solver thread (see ExportModule::doDeferredOutput) and
+ * the snapshots are written by a background export thread, while the solution continues. The solver waits only
+ * when the queue of pending outputs is full. All pending outputs are written before the modules are (re)initialized
+ * or terminated.
  */
 class OOFEM_EXPORT ExportModuleManager : public ModuleManager< ExportModule >
 {
+protected:
+    /// Maximum number of pending outputs in asynchronous mode, zero for synchronous output.
+    int asyncQueueSize;
+    /// Pending outputs, written in order by the export thread.
+    std :: deque< std :: function< void() > >taskQueue;
+    /// Number of outputs being written (0 or 1).
+    int runningTasks;
+    /// Flag requesting the export thread to finish.
+    bool stopExportThread;
+    /// Export thread, started on first pending output.
+    std :: thread exportThread;
+    /// Guards taskQueue, runningTasks and stopExportThread.
+    std :: mutex queueMutex;
+    /// Signals any change of queue state.
+    std :: condition_variable queueChanged;
+
 public:
     ExportModuleManager(EngngModel * emodel);
     virtual ~ExportModuleManager();
@@ -68,7 +101,19 @@ public:
      * Terminates the receiver, the corresponding terminate module services are called.
      */
     void terminate();
+    /**
+     * Waits until all pending outputs are written (asynchronous mode only).
+     */
+    void flush();
     const char *giveClassName() const override { return "ExportModuleManager"; }
+
+protected:
+    /// Adds output task to the queue, waits if the queue is full.
+    void enqueueTask(std :: function< void() >task);
+    /// Main loop of the export thread.
+    void exportLoop();
+    /// Writes pending outputs and stops the export thread.
+    void stopExport();
 };
 } // end namespace oofem
 #endif // exportmodulemanager_h
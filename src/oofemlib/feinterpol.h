@@ -44,6 +44,11 @@
 #include "materialmode.h"
 #include "node.h"
 #include "element.h"
+#include "floatarray.h"
+#include "floatmatrix.h"
+
+#include <memory>
+#include <vector>
 
 namespace oofem {
 class Element;
@@ -51,6 +56,8 @@ class FloatArray;
 class FloatMatrix;
 class IntArray;
 class IntegrationRule;
+class GaussPoint;
+class FEInterpolation;
 
 template <int N> class FloatArrayF;
 template <int N, int M> class FloatMatrixF;
@@ -130,6 +137,34 @@ public:
     const FloatArray &giveVertexCoordinates(int i) const override { return this->coords [ i - 1 ]; }
 };
 
+/**
+ * Interpolation functions and their derivatives with respect to parent coordinates, tabulated at the points
+ * of an integration rule. The values depend only on the interpolation class and the integration points,
+ * so a single table is shared by all elements using them; element kernels then only perform the mapping
+ * to the physical element.
+ */
+class OOFEM_EXPORT FEIReferenceTable
+{
+public:
+    /// Integration domain of the rule.
+    integrationDomain domain;
+    /// Local coordinates of integration points.
+    std :: vector< FloatArray >coords;
+    /// Interpolation functions at integration points.
+    std :: vector< FloatArray >N;
+    /// Derivatives of interpolation functions wrt. parent coordinates at integration points.
+    std :: vector< FloatMatrix >dNdxi;
+
+    /// Tabulates the interpolation functions of given interpolation at the points of given rule.
+    FEIReferenceTable(FEInterpolation &interp, IntegrationRule &ir);
+
+    /// Returns true if the table has been built for a rule equivalent to the one of given integration point.
+    bool isValidFor(GaussPoint *gp) const;
+};
+
+/// Storage of reference tables of an interpolation class.
+typedef std :: vector< std :: unique_ptr< FEIReferenceTable > >FEIReferenceTableStorage;
+
 /**
  * Class representing a general abstraction for finite element interpolation class.
  * The boundary functions denote the (numbered) region that have 1 spatial dimension (i.e. edges) or 2 spatial dimensions.
@@ -245,6 +280,43 @@ public:
     virtual std::unique_ptr<IntegrationRule> giveIntegrationRule(int order);
     //@}
 
+    /** @name Services evaluated at integration points
+     * Equivalent to the services above evaluated at the local coordinates of the integration point.
+     * Interpolations providing the reference table (see giveReferenceTable) reuse the tabulated values
+     * of interpolation functions and their parent derivatives instead of evaluating them again.
+     */
+    //@{
+    /**
+     * Evaluates the array of interpolation functions at given integration point.
+     * @param answer Contains resulting array of evaluated interpolation functions.
+     * @param gp Integration point.
+     * @param cellgeo Underlying cell geometry.
+     */
+    virtual void evalNAt(FloatArray &answer, GaussPoint *gp, const FEICellGeometry &cellgeo);
+    /**
+     * Evaluates the matrix of derivatives of interpolation functions (in global coordinate system) at given integration point.
+     * @param answer Contains resulting matrix of derivatives, the member at i,j position contains value of dNi/dxj.
+     * @param gp Integration point.
+     * @param cellgeo Underlying cell geometry.
+     * @return Determinant of the Jacobian.
+     */
+    virtual double evaldNdxAt(FloatMatrix &answer, GaussPoint *gp, const FEICellGeometry &cellgeo);
+    /**
+     * Evaluates the determinant of the transformation at given integration point.
+     * @param gp Integration point.
+     * @param cellgeo Underlying cell geometry.
+     * @return Determinant of the transformation.
+     */
+    virtual double giveTransformationJacobianAt(GaussPoint *gp, const FEICellGeometry &cellgeo);
+    /**
+     * Gives the table of interpolation functions and their parent derivatives tabulated at the points
+     * of the integration rule of given point.
+     * @param gp Integration point.
+     * @return Reference table, NULL if the receiver does not support tabulation or the table does not apply to given point.
+     */
+    virtual const FEIReferenceTable *giveReferenceTable(GaussPoint *gp) { return nullptr; }
+    //@}
+
     /** @name Edge boundary functions.
      * Provide interpolation services for boundary edges (entity of dimension 1)
      */
@@ -485,6 +557,15 @@ public:
     //@}
 
     std :: string errorInfo(const char *func) const { return func; } ///@todo Class name?
+
+protected:
+    /**
+     * Finds (or builds) the reference table for the integration rule of given point in given storage.
+     * Interpolations supporting the tabulation implement giveReferenceTable using this service and
+     * a storage specific to the interpolation class. The storage should be thread local, tables are
+     * then built on demand without any locking.
+     */
+    const FEIReferenceTable *findReferenceTable(FEIReferenceTableStorage &storage, GaussPoint *gp);
 };
 } // end namespace oofem
 #endif // feinterpol_h
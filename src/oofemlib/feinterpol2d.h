@@ -47,11 +47,17 @@ class OOFEM_EXPORT FEInterpolation2d : public FEInterpolation
 protected:
     int xind, yind;
 
+    /// Computes the Jacobian matrix (transposed, dx_j/dxi_i) from tabulated parent derivatives.
+    void computeJacobianFromTable(FloatMatrix &jacobianMatrix, const FloatMatrix &dn, const FEICellGeometry &cellgeo);
+
 public:
     FEInterpolation2d(int o, int ind1, int ind2) : FEInterpolation(o), xind(ind1), yind(ind2) { }
 
     int giveNsd() override { return 2; }
 
+    double evaldNdxAt(FloatMatrix &answer, GaussPoint *gp, const FEICellGeometry &cellgeo) override;
+    double giveTransformationJacobianAt(GaussPoint *gp, const FEICellGeometry &cellgeo) override;
+
     /**
      * Computes the exact area.
      * @param cellgeo Cell geometry for the element.
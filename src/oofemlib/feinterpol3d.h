@@ -47,6 +47,9 @@ public:
     FEInterpolation3d(int o) : FEInterpolation(o) { }
     int giveNsd() override { return 3; }
 
+    double evaldNdxAt(FloatMatrix &answer, GaussPoint *gp, const FEICellGeometry &cellgeo) override;
+    double giveTransformationJacobianAt(GaussPoint *gp, const FEICellGeometry &cellgeo) override;
+
     /**
      * Computes the exact volume.
      * @param cellgeo Cell geometry for the element.
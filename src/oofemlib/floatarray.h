@@ -36,6 +36,7 @@
 #define floatarray_h
 
 #include "oofemcfg.h"
+#include "poolallocator.h"
 #include "contextioresulttype.h"
 #include "contextmode.h"
 #include "error.h"
@@ -84,16 +85,16 @@ template<int N> class FloatArrayF;
 class OOFEM_EXPORT FloatArray
 {
 protected:
-    /// Stored values.
-    std::vector< double > values;
+    /// Stored values (allocated from thread local memory pool, see MemoryPool).
+    std::vector< double, PoolAllocator< double > > values;
 
 public:
     /// @name Iterator for for-each loops:
     //@{
-    std::vector< double > :: iterator begin() { return this->values.begin(); }
-    std::vector< double > :: iterator end() { return this->values.end(); }
-    std::vector< double > :: const_iterator begin() const { return this->values.begin(); }
-    std::vector< double > :: const_iterator end() const { return this->values.end(); }
+    std::vector< double, PoolAllocator< double > > :: iterator begin() { return this->values.begin(); }
+    std::vector< double, PoolAllocator< double > > :: iterator end() { return this->values.end(); }
+    std::vector< double, PoolAllocator< double > > :: const_iterator begin() const { return this->values.begin(); }
+    std::vector< double, PoolAllocator< double > > :: const_iterator end() const { return this->values.end(); }
     //@}
 
     /// Constructor for sized array. Data is zeroed.
@@ -36,6 +36,7 @@
 #define flotmtrx_h
 
 #include "oofemcfg.h"
+#include "poolallocator.h"
 #include "contextioresulttype.h"
 #include "contextmode.h"
 
@@ -94,16 +95,16 @@ protected:
     int nRows;
     /// Number of columns.
     int nColumns;
-    /// Values of matrix stored column wise.
-    std :: vector< double >values;
+    /// Values of matrix stored column wise (allocated from thread local memory pool, see MemoryPool).
+    std :: vector< double, PoolAllocator< double > >values;
 
 public:
     /// @name Iterator for for-each loops (columns-wise order):
     //@{
-    std::vector< double > :: iterator begin() { return this->values.begin(); }
-    std::vector< double > :: iterator end() { return this->values.end(); }
-    std::vector< double > :: const_iterator begin() const { return this->values.begin(); }
-    std::vector< double > :: const_iterator end() const { return this->values.end(); }
+    std::vector< double, PoolAllocator< double > > :: iterator begin() { return this->values.begin(); }
+    std::vector< double, PoolAllocator< double > > :: iterator end() { return this->values.end(); }
+    std::vector< double, PoolAllocator< double > > :: const_iterator begin() const { return this->values.begin(); }
+    std::vector< double, PoolAllocator< double > > :: const_iterator end() const { return this->values.end(); }
     //@}
 
     /**
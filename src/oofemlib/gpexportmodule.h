@@ -36,8 +36,10 @@
 #define gpexportmodule_h_
 
 #include "exportmodule.h"
+#include "floatarray.h"
 
 #include <cstdio>
+#include <vector>
 
 ///@name Input fields for Gausspoint export module
 //@{
@@ -62,6 +64,14 @@ protected:
     /// Number of coordinates to be exported (at each Gauss point)
     int ncoords;
 
+    /// Exported data of one Gauss point, copied from the problem for deferred output.
+    struct GPRecord {
+        int element, rule, point;
+        double weight;
+        FloatArray coords;
+        std :: vector< FloatArray >values;
+    };
+
 public:
     /// Constructor. Creates empty Output Manager. By default all components are selected.
     GPExportModule(int n, EngngModel * e);
@@ -70,14 +80,22 @@ public:
 
     IRResultType initializeFrom(InputRecord *ir) override;
     void doOutput(TimeStep *tStep, bool forcedOutput = false) override;
+    std :: function< void() >doDeferredOutput(TimeStep *tStep, bool forcedOutput = false) override;
     void initialize() override;
     void terminate() override;
     const char *giveClassName() const override { return "GPExportModule"; }
     const char *giveInputRecordName() const { return _IFT_GPExportModule_Name; }
 
 protected:
-    /// Returns the output stream for given solution step
-    FILE *giveOutputStream(TimeStep *tStep);
+    /// Returns the output stream for given file name.
+    FILE *giveOutputStream(const std :: string &fileName);
+    /**
+     * Copies the exported data of all Gauss points of given step and returns the task writing them.
+     * The task does not access the problem.
+     */
+    std :: function< void() >giveOutputTask(TimeStep *tStep);
+    /// Writes the copied Gauss point data into file.
+    void writeGPFile(const std :: string &fileName, double time, const std :: vector< GPRecord > &records);
 };
 } // namespace oofem
 
@@ -0,0 +1,126 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef graphordering_h
+#define graphordering_h
+
+#include "oofemcfg.h"
+
+#include <vector>
+
+namespace oofem {
+/**
+ * Fill reducing ordering of undirected graph of symmetric sparse matrix.
+ * The graph is given in compressed row format (0-based, without self loops, each edge stored in both directions).
+ *
+ * The nested dissection ordering recursively splits the graph by vertex separators, the separator vertices
+ * are ordered after both parts. Separators are obtained from the rooted level structure of the (sub)graph,
+ * starting from pseudo-peripheral vertex: the level splitting the vertices into halves is selected and only its
+ * vertices adjacent to the next level are kept in the separator. Disconnected subgraphs are ordered independently.
+ * Besides reducing the fill, the resulting elimination tree is wide and well balanced, which is
+ * exploited by parallel factorization.
+ * The geometric variant splits the vertices by coordinate bisection (along the largest extent of the bounding box)
+ * and takes the smaller of the two boundaries as separator.
+ *
+ * The minimum degree ordering works on the quotient graph (eliminated vertices are represented by elements) and uses
+ * the approximate external degrees with aggressive element absorption, in the spirit of AMD.
+ *
+ * Any ordering can be evaluated by the predicted size of the Cholesky factor (symbolic factorization).
+ */
+class OOFEM_EXPORT GraphOrdering
+{
+protected:
+    /// Number of vertices.
+    int nVertices;
+    /// Adjacency pointers (nVertices + 1 entries).
+    std :: vector< int >adjPtr;
+    /// Adjacent vertices.
+    std :: vector< int >adj;
+
+public:
+    /**
+     * Constructor.
+     * @param n Number of vertices.
+     * @param ptr Adjacency pointers, the neighbours of vertex i are adj[ptr[i]], ..., adj[ptr[i+1]-1].
+     * @param adj Adjacent vertices.
+     */
+    GraphOrdering(int n, std :: vector< int >ptr, std :: vector< int >adj);
+
+    /**
+     * Computes the nested dissection ordering.
+     * @param perm Permutation, perm[i] is the vertex ordered at position i.
+     * @param leafSize Subgraphs with size up to leafSize are not split further.
+     */
+    void nestedDissection(std :: vector< int > &perm, int leafSize = 32) const;
+    /**
+     * Computes the geometric nested dissection ordering.
+     * Vertices without coordinates (NaN) are ordered last, as the top separator.
+     * @param perm Permutation, perm[i] is the vertex ordered at position i.
+     * @param coords Coordinates of vertices (three per vertex).
+     * @param leafSize Subgraphs with size up to leafSize are not split further.
+     */
+    void coordinateNestedDissection(std :: vector< int > &perm, const std :: vector< double > &coords, int leafSize = 32) const;
+    /**
+     * Computes the approximate minimum degree ordering.
+     * @param perm Permutation, perm[i] is the vertex ordered at position i.
+     */
+    void minimumDegree(std :: vector< int > &perm) const;
+    /**
+     * Computes the number of nonzero entries in the lower triangle (including diagonal) of Cholesky factor of the matrix
+     * permuted by given ordering. Each vertex may represent a block of equations.
+     * @param perm Permutation, perm[i] is the vertex ordered at position i.
+     * @param weights Number of equations of each vertex (empty for single equation per vertex).
+     * @return Size of the factor.
+     */
+    std :: size_t giveFactorSize(const std :: vector< int > &perm, const std :: vector< int > &weights) const;
+
+protected:
+    /**
+     * Computes the rooted level structure of subgraph (vertices with given region mark) by breadth-first search.
+     * @param root Root vertex.
+     * @param region Region marks of vertices.
+     * @param id Region mark of subgraph.
+     * @param level Level numbers of visited vertices (only the visited vertices are set).
+     * @param order Visited vertices, ordered by levels.
+     * @param levelPtr Positions of levels in order.
+     */
+    void giveLevelStructure(int root, const std :: vector< int > &region, int id, std :: vector< int > &level,
+                            std :: vector< int > &order, std :: vector< int > &levelPtr) const;
+    /// Returns the root of (approximately) longest level structure of subgraph containing start vertex.
+    int givePseudoPeripheralVertex(int start, const std :: vector< int > &region, int id, std :: vector< int > &level,
+                                   std :: vector< int > &order, std :: vector< int > &levelPtr) const;
+};
+} // end namespace oofem
+#endif // graphordering_h
@@ -38,6 +38,8 @@
 #include "feinterpol.h"
 #include "floatarray.h"
 
+#include <array>
+
 ///@name Input fields for BSplineInterpolation
 //@{
 #define _IFT_BSplineInterpolation_degree "degree"
@@ -0,0 +1,191 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef amgprecond_h
+#define amgprecond_h
+
+#include "precond.h"
+
+#include <vector>
+#include <cstddef>
+
+///@name Input fields for AMGPreconditioner
+//@{
+#define _IFT_AMGPreconditioner_theta "amgtheta"
+#define _IFT_AMGPreconditioner_coarseSize "amgcoarse"
+#define _IFT_AMGPreconditioner_maxLevels "amglevels"
+#define _IFT_AMGPreconditioner_degree "amgdegree"
+#define _IFT_AMGPreconditioner_reuse "amgreuse"
+//@}
+
+namespace oofem {
+class Domain;
+
+/**
+ * Smoothed aggregation algebraic multigrid preconditioner.
+ * One application of the preconditioner is a symmetric V-cycle with Chebyshev smoothing,
+ * the coarsest operator is factorized directly.
+ *
+ * The coarse spaces are built by aggregation of the degrees of freedom of neighbouring
+ * dof managers, the near null space of the operator is taken from the domain: rigid body modes
+ * computed from node coordinates for displacement and rotation dofs and a constant vector
+ * for every other dof type. If no domain is given, scalar aggregation with a constant
+ * near null space is used.
+ *
+ * When the receiver is initialized by a matrix with unchanged sparsity pattern
+ * (typical for Newton iterations), the aggregates and tentative prolongators are kept and only
+ * the Galerkin products are recomputed (or the whole hierarchy is kept, see amgreuse).
+ *
+ * Works with CompCol, SymCompCol, DynCompRow and DynCompCol matrices.
+ * The setup and the cycle are parallelized using OpenMP.
+ */
+class OOFEM_EXPORT AMGPreconditioner : public Preconditioner
+{
+public:
+    /// Determines how much of the hierarchy is reused when the matrix pattern has not changed.
+    enum ReuseType {
+        AMG_Rebuild = 0,         ///< Full setup in each init.
+        AMG_ReuseAggregates = 1, ///< Aggregates and tentative prolongators are kept, operators are recomputed.
+        AMG_ReuseHierarchy = 2,  ///< Whole hierarchy is kept, new matrix values are ignored.
+    };
+
+    /// Compressed row storage (0-based) of level operators and transfer operators.
+    struct CSRMatrix {
+        int nRows = 0;
+        int nCols = 0;
+        std :: vector< int > ptr;
+        std :: vector< int > col;
+        std :: vector< double > val;
+
+        /// Computes y = A x.
+        void times(const double *x, double *y) const;
+    };
+
+protected:
+    /// Single level of the hierarchy.
+    struct Level {
+        /// Level operator.
+        CSRMatrix A;
+        /// Tentative (unsmoothed) prolongator to next level.
+        CSRMatrix Pt;
+        /// Smoothed prolongator and restriction.
+        CSRMatrix P, R;
+        /// Inverse of diagonal of A.
+        std :: vector< double > invDiag;
+        /// Estimate of spectral radius of D^{-1} A.
+        double rho = 1.0;
+        /// Work vectors used by cycle.
+        mutable std :: vector< double > x, b, r, d, w;
+    };
+
+    /// Domain used to build the near null space (may be null).
+    Domain *domain;
+    /// Hierarchy, first level is the fine one.
+    std :: vector< Level >levels;
+    /// Dense LDL^T factor of coarsest operator (empty if coarsest level is smoothed only).
+    std :: vector< double >coarseFactor;
+    /// Pattern fingerprint of fine operator the hierarchy was built for.
+    std :: size_t fingerprint;
+
+    /// Strength of connection threshold.
+    double theta;
+    /// Size below which the level is solved directly.
+    int coarseSize;
+    /// Max number of levels.
+    int maxLevels;
+    /// Degree of Chebyshev smoother.
+    int degree;
+    /// Reuse mode.
+    ReuseType reuse;
+
+public:
+    /// Constructor. The domain provides the near null space of the operator.
+    AMGPreconditioner(Domain * d = nullptr);
+    /// Destructor
+    virtual ~AMGPreconditioner() { }
+
+    void init(const SparseMtrx &a) override;
+
+    void solve(const FloatArray &rhs, FloatArray &solution) const override;
+    void trans_solve(const FloatArray &rhs, FloatArray &solution) const override { this->solve(rhs, solution); }
+
+    const char *giveClassName() const override { return "AMG"; }
+    IRResultType initializeFrom(InputRecord *ir) override;
+
+    /// Returns number of levels of the hierarchy.
+    int giveNumberOfLevels() const { return (int)levels.size(); }
+    /**
+     * Returns the operator complexity, i.e. sum of nonzeros of all level operators
+     * divided by the number of nonzeros of the fine operator.
+     */
+    double giveOperatorComplexity() const;
+
+    /// Converts supported sparse matrix into compressed row storage.
+    static void convert(const SparseMtrx &a, CSRMatrix &answer);
+    /// Computes C = A B.
+    static void multiply(const CSRMatrix &a, const CSRMatrix &b, CSRMatrix &answer);
+    /// Computes A^T.
+    static void transpose(const CSRMatrix &a, CSRMatrix &answer);
+
+protected:
+    /**
+     * Builds the near null space of fine operator.
+     * @param neq Number of equations.
+     * @param eqNode Dof manager (node) index of each equation.
+     * @param nNodes Number of nodes.
+     * @param B Near null space, row-major neq x nvec.
+     * @param nvec Number of null space vectors.
+     */
+    void giveNearNullspace(int neq, std :: vector< int > &eqNode, int &nNodes, std :: vector< double > &B, int &nvec) const;
+    /// Aggregates the nodes of given operator, returns number of aggregates.
+    int aggregate(const CSRMatrix &a, const std :: vector< int > &eqNode, int nNodes, std :: vector< int > &nodeAggregate) const;
+    /**
+     * Builds the tentative prolongator by local QR decomposition of the near null space on each aggregate.
+     * Coarse near null space and coarse equation-node map are returned.
+     */
+    static void tentativeProlongator(const std :: vector< int > &eqNode, const std :: vector< int > &nodeAggregate, int nAggregates,
+                                     const std :: vector< double > &B, int nvec,
+                                     CSRMatrix &Pt, std :: vector< int > &coarseEqNode, std :: vector< double > &Bc);
+    /// Computes diagonal, spectral radius, smoothed prolongator and the coarse operator of given level.
+    void computeLevelOperators(int level);
+    /// Factorizes the coarsest operator.
+    void factorizeCoarse();
+    /// Chebyshev smoothing of given level, x is assumed zero if zeroGuess is set.
+    void smooth(const Level &l, const double *b, double *x, bool zeroGuess) const;
+    /// Applies the V-cycle starting at given level; rhs and solution are the level work vectors.
+    void cycle(int level) const;
+};
+} // end namespace oofem
+#endif // amgprecond_h
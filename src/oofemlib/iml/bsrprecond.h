@@ -0,0 +1,99 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef bsrprecond_h
+#define bsrprecond_h
+
+#include "precond.h"
+
+#include <vector>
+
+namespace oofem {
+class BSRMatrix;
+
+/**
+ * Block Jacobi preconditioner for BSRMatrix.
+ * The diagonal blocks (dofs of a dof manager) are inverted and applied block by block.
+ */
+class OOFEM_EXPORT BSR_JacobiPreconditioner : public Preconditioner
+{
+protected:
+    /// Matrix the receiver was initialized from (provides the block numbering).
+    const BSRMatrix *matrix;
+    /// Inverted diagonal blocks, stored row-wise.
+    std :: vector< double >dinv;
+    /// Work vectors.
+    mutable std :: vector< double >xb, yb;
+
+public:
+    /// Constructor. The user should call initializeFrom and init services in this given order to ensure consistency.
+    BSR_JacobiPreconditioner() : Preconditioner(), matrix(nullptr) { }
+    /// Destructor
+    virtual ~BSR_JacobiPreconditioner() { }
+
+    void init(const SparseMtrx &a) override;
+    void solve(const FloatArray &rhs, FloatArray &solution) const override;
+    void trans_solve(const FloatArray &rhs, FloatArray &solution) const override;
+    const char *giveClassName() const override { return "BlockJacobi"; }
+};
+
+
+/**
+ * Block incomplete LU factorization with no fill-up (BILU(0)) of BSRMatrix.
+ * The factors have the block structure of the matrix; pivots are the inverted diagonal blocks.
+ */
+class OOFEM_EXPORT BSR_ILUPreconditioner : public Preconditioner
+{
+protected:
+    /// Matrix the receiver was initialized from (provides the block structure).
+    const BSRMatrix *matrix;
+    /// Factor values in the block structure of the matrix; the diagonal blocks hold the inverted pivots.
+    std :: vector< double >lu;
+    /// Work vectors.
+    mutable std :: vector< double >xb, yb;
+
+public:
+    /// Constructor. The user should call initializeFrom and init services in this given order to ensure consistency.
+    BSR_ILUPreconditioner() : Preconditioner(), matrix(nullptr) { }
+    /// Destructor
+    virtual ~BSR_ILUPreconditioner() { }
+
+    void init(const SparseMtrx &a) override;
+    void solve(const FloatArray &rhs, FloatArray &solution) const override;
+    void trans_solve(const FloatArray &rhs, FloatArray &solution) const override;
+    const char *giveClassName() const override { return "BlockILU"; }
+};
+} // end namespace oofem
+#endif // bsrprecond_h
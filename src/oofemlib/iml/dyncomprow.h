@@ -82,11 +82,13 @@ public:
     std::unique_ptr<SparseMtrx> clone() const override;
     void times(const FloatArray &x, FloatArray &answer) const override;
     void timesT(const FloatArray &x, FloatArray &answer) const override;
+    void times(const FloatMatrix &B, FloatMatrix &answer) const override;
     void times(double x) override;
     int buildInternalStructure(EngngModel *, int, const UnknownNumberingScheme &) override;
     int assemble(const IntArray &loc, const FloatMatrix &mat) override;
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
     bool canBeFactorized() const override { return false; }
+    bool supportsConcurrentAssembly() const override { return true; }
     void zero() override;
     const char* giveClassName() const override { return "DynCompRow"; }
     SparseMtrxType  giveType() const override { return SMT_DynCompRow; }
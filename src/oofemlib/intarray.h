@@ -36,6 +36,7 @@
 #define intarray_h
 
 #include "oofemcfg.h"
+#include "poolallocator.h"
 #include "contextioresulttype.h"
 #include "contextmode.h"
 #include "error.h"
@@ -62,16 +63,16 @@ class DataStream;
 class OOFEM_EXPORT IntArray
 {
 private:
-    /// Stored values.
-    std::vector< int > values;
+    /// Stored values (allocated from thread local memory pool, see MemoryPool).
+    std::vector< int, PoolAllocator< int > > values;
 
 public:
     /// @name Iterator for for-each loops:
     //@{
-    std::vector< int > :: iterator begin() { return this->values.begin(); }
-    std::vector< int > :: iterator end() { return this->values.end(); }
-    std::vector< int > :: const_iterator begin() const { return this->values.begin(); }
-    std::vector< int > :: const_iterator end() const { return this->values.end(); }
+    std::vector< int, PoolAllocator< int > > :: iterator begin() { return this->values.begin(); }
+    std::vector< int, PoolAllocator< int > > :: iterator end() { return this->values.end(); }
+    std::vector< int, PoolAllocator< int > > :: const_iterator begin() const { return this->values.begin(); }
+    std::vector< int, PoolAllocator< int > > :: const_iterator end() const { return this->values.end(); }
     //@}
 
     /// Constructor for sized array. Data is zeroed.
@@ -0,0 +1,168 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef ipstatestore_h
+#define ipstatestore_h
+
+#include "oofemcfg.h"
+
+#include <vector>
+#include <memory>
+
+namespace oofem {
+/**
+ * Contiguous storage of scalar history variables of integration points, organized as structure of arrays.
+ * The store keeps, for each integration point (slot), a fixed number of variables, each one in its
+ * equilibrated and temporary (non-equilibrated) version.
+ *
+ * Slots are allocated in blocks of BlockSize integration points. Within a block, the values of one
+ * variable are stored contiguously, followed by the next variable; the temporary values follow the
+ * equilibrated ones. The end-of-step update (copying temporary values to equilibrated ones) of the
+ * whole store thus reduces to one sweep over contiguous arrays per block, instead of traversing the individual
+ * material statuses. Blocks are never moved, so the slots remain valid for the lifetime of the store.
+ * The slots released by their statuses are reused by subsequent allocations.
+ *
+ * The stores are usually owned by the domain, one per material and element set (see Domain::giveIPStateStore),
+ * and updated in bulk at the end of each solution step (see Domain::updateIPStateStores).
+ * During the bulk update (see beginUpdate), the statuses backed by the store only mark their slots
+ * for update; only the marked slots (of updated, i.e. local and active, elements) are then updated by updateYourself.
+ */
+class OOFEM_EXPORT IPStateStore
+{
+public:
+    /// Number of slots allocated at once.
+    static const int BlockSize = 1024;
+
+    /**
+     * Handle of the variables of single integration point.
+     * The handle may also refer to the local storage of status, when not backed by any store.
+     */
+    class Slot
+    {
+    protected:
+        /// Equilibrated values.
+        double *converged;
+        /// Temporary values.
+        double *temp;
+        /// Number of variables.
+        int size;
+        /// Distance between two subsequent variables.
+        int stride;
+        /// Update flag of the slot in store (NULL for local storage).
+        char *updateFlag;
+        /// Index of the slot in store (-1 for local storage).
+        int index;
+
+    public:
+        Slot() : converged(nullptr), temp(nullptr), size(0), stride(1), updateFlag(nullptr), index(-1) { }
+        /**
+         * Creates handle to local storage.
+         * @param values Array of 2*n values, the equilibrated values followed by the temporary ones.
+         * @param n Number of variables.
+         */
+        Slot(double *values, int n) : converged(values), temp(values + n), size(n), stride(1), updateFlag(nullptr), index(-1) { }
+        Slot(double *c, double *t, int n, int s, char *f, int i) : converged(c), temp(t), size(n), stride(s), updateFlag(f), index(i) { }
+
+        /// Returns the number of variables.
+        int giveSize() const { return size; }
+        /// Returns the equilibrated value of i-th variable (0-based).
+        double giveConverged(int i) const { return converged [ i * stride ]; }
+        /// Returns the temporary value of i-th variable (0-based).
+        double giveTemp(int i) const { return temp [ i * stride ]; }
+        /// Sets the equilibrated value of i-th variable (0-based).
+        void setConverged(int i, double v) { converged [ i * stride ] = v; }
+        /// Sets the temporary value of i-th variable (0-based).
+        void setTemp(int i, double v) { temp [ i * stride ] = v; }
+        /// Copies the temporary values to the equilibrated ones.
+        void update();
+        /// Marks the slot to be updated by the bulk update of store.
+        void markForUpdate() { * updateFlag = 1; }
+        /// Returns the index of the slot in store, -1 for local storage.
+        int giveIndex() const { return index; }
+        /// Copies all values from given slot with the same number of variables.
+        void copyFrom(const Slot &src);
+    };
+
+protected:
+    /// Number of variables per slot.
+    int nVariables;
+    /// Number of slots allocated so far, including the released ones.
+    int nSlots;
+    /// Allocated blocks, each with 2 * nVariables * BlockSize values.
+    std :: vector< std :: unique_ptr< double[] > >blocks;
+    /// Update flags of the slots of each block.
+    std :: vector< std :: unique_ptr< char[] > >updateFlags;
+    /// Indices of released slots, available for reuse.
+    std :: vector< int >freeSlots;
+    /// Flag indicating that the bulk update is in progress.
+    bool updating;
+
+public:
+    /**
+     * Constructor.
+     * @param n Number of variables per integration point.
+     */
+    IPStateStore(int n);
+
+    /**
+     * Allocates new slot, initialized to zero values.
+     * Thread safe; the slots allocated before are not affected.
+     */
+    Slot allocateSlot();
+    /**
+     * Releases given slot, which can be reused by subsequent allocations.
+     * Thread safe.
+     */
+    void releaseSlot(const Slot &slot);
+
+    /// Returns the number of variables per slot.
+    int giveNumberOfVariables() const { return nVariables; }
+    /// Returns the number of slots in use.
+    int giveNumberOfSlots() const { return nSlots - ( int ) freeSlots.size(); }
+
+    /**
+     * Starts the bulk update. Until updateYourself is called, the statuses mark their slots for update
+     * (see Slot::markForUpdate) instead of updating them.
+     */
+    void beginUpdate() { updating = true; }
+    /// Returns true if the bulk update is in progress.
+    bool isUpdating() const { return updating; }
+    /**
+     * Copies the temporary values of the slots marked for update to equilibrated ones and finishes the bulk update.
+     */
+    void updateYourself();
+};
+} // end namespace oofem
+#endif // ipstatestore_h
@@ -246,6 +246,16 @@ public:
      * @return Zero on error.
      */
     virtual int initMaterial(Element *element);
+    /**
+     * Evaluates the integration points of the receiver in the whole domain before the element contributions
+     * are assembled. Called outside of parallel regions, once for each assembled vector of internal forces or
+     * tangent matrix. Materials with expensive evaluation (e.g. solving a subscale problem) may evaluate all
+     * their integration points concurrently here and reuse the results when the elements ask for them.
+     * Default implementation does nothing.
+     * @param tStep Time step.
+     * @param tangent If true, tangent matrix is assembled, otherwise internal forces.
+     */
+    virtual void updateBeforeAssembly(TimeStep *tStep, bool tangent) { }
     /**
      * Returns material status of receiver in given integration point.
      * If status does not exist yet, it is created using CreateStatus member function.
@@ -36,6 +36,7 @@
 #define matlabexportmodule_h_
 
 #include <vector>
+#include <string>
 
 #include "exportmodule.h"
 
@@ -78,7 +79,12 @@ protected:
     IntArray primaryVarsToExport;
     std :: string functionname;
 
-    FILE *giveOutputStream(TimeStep *);
+    std :: string giveOutputFileName(TimeStep *tStep);
+    /**
+     * Formats the export file of given step into a buffer.
+     * @return Task writing the buffer to the file.
+     */
+    std :: function< void() >giveOutputTask(TimeStep *tStep);
     std :: vector< double >smax;
     std :: vector< double >smin;
 
@@ -115,15 +121,16 @@ public:
 
     IRResultType initializeFrom(InputRecord *ir) override;
     void doOutput(TimeStep *tStep, bool forcedOutput = false) override;
+    std :: function< void() >doDeferredOutput(TimeStep *tStep, bool forcedOutput = false) override;
     void initialize() override;
     void terminate() override;
 
-    void doOutputMesh(TimeStep *tStep, FILE *FID);
-    void doOutputData(TimeStep *tStep, FILE *FID);
-    void doOutputSpecials(TimeStep *tStep, FILE *FID);
-    void doOutputReactionForces(TimeStep *tStep, FILE *FID);
-    void doOutputIntegrationPointFields(TimeStep *tStep, FILE *FID);
-    void doOutputHomogenizeDofIDs(TimeStep *tStep, FILE *FID);
+    void doOutputMesh(TimeStep *tStep, std :: string &out);
+    void doOutputData(TimeStep *tStep, std :: string &out);
+    void doOutputSpecials(TimeStep *tStep, std :: string &out);
+    void doOutputReactionForces(TimeStep *tStep, std :: string &out);
+    void doOutputIntegrationPointFields(TimeStep *tStep, std :: string &out);
+    void doOutputHomogenizeDofIDs(TimeStep *tStep, std :: string &out);
 
     const char *giveClassName() const override { return "MatlabExportModule"; }
     const char *giveInputRecordName() const { return _IFT_MatlabExportModule_Name; }
@@ -71,10 +71,11 @@ public:
     /// Destructor.
     virtual ~NodalAveragingRecoveryModel();
 
-    int recoverValues(Set elementSet, InternalStateType type, TimeStep *tStep) override;
-
     const char *giveClassName() const override { return "NodalAveragingRecoveryModel"; }
 
+protected:
+    int recoverRegionValues(Set &elementSet, const std :: vector< InternalStateType > &types, TimeStep *tStep) override;
+
 private:
 #ifdef __PARALLEL_MODE
     void initCommMaps();
@@ -44,6 +44,7 @@
 #include "set.h"
 
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace oofem {
@@ -61,6 +62,12 @@ class ProblemCommunicator;
  * The element set can be set up in the input file, or created dynamically.
  * If Averaging over multiple regions is needed, multiple instances of nodal recovery model should be created,
  * o single instance reused.
+ *
+ * Several internal state types can be recovered at once, in a single pass over region elements.
+ * The data depending only on region (local node numbering, patches, mass matrix) are kept for each
+ * region (element set) between recoveries and rebuilt only when the mesh changes. The recovered values
+ * of each region are kept until the solution state changes, so that the receiver can be shared by several
+ * export modules recovering on different regions (see Domain :: giveNodalRecoveryModel).
  */
 class OOFEM_EXPORT NodalRecoveryModel
 {
@@ -69,14 +76,36 @@ public:
 
 protected:
     /**
-     * Map of nodal values. Only nodes for active region are determined and stored.
-     * The node number is dictionary key to corresponding values.
+     * Data of one region: local node numbering, data of derived models and recovered values.
+     * Derived models keep their own region data in derived records (see createRegion).
      */
-    std :: map< int, FloatArray >nodalValList;
-    /// Determines the type of recovered values.
+    struct Region {
+        /// Elements of the region.
+        IntArray elements;
+        /// Number of domain elements when region data were determined.
+        int domainElements;
+        /// Local region numbering of dof managers (zero for dof managers outside region).
+        IntArray nodalNumbers;
+        /// Number of dof managers in region.
+        int dofMans;
+        /**
+         * Map of nodal values of recovered types. Only nodes of region are determined and stored.
+         * The internal state type and node number are dictionary keys to corresponding values.
+         */
+        std :: map< InternalStateType, std :: map< int, FloatArray > >nodalValList;
+        /// Time stamp of recovered values.
+        StateCounterType stateCounter;
+
+        Region() : elements(), domainElements(0), nodalNumbers(), dofMans(0), nodalValList(), stateCounter(0) { }
+        virtual ~Region() { }
+    };
+
+    /// Regions with determined data, the element lists of regions are the keys.
+    std :: map< std :: vector< int >, std :: unique_ptr< Region > >regions;
+    /// Region of the last recovery, to which giveNodalVector refers.
+    Region *region;
+    /// Determines the type of recovered values returned by giveNodalVector without type.
     InternalStateType valType;
-    /// Time stamp of recovered values.
-    StateCounterType stateCounter;
     Domain *domain;
 
 #ifdef __PARALLEL_MODE
@@ -94,26 +123,43 @@ public:
     /// Destructor
     virtual ~NodalRecoveryModel();
 
-    void setDomain(Domain *ipDomain) { domain = ipDomain; }
+    void setDomain(Domain *ipDomain) { domain = ipDomain; this->clear(); }
 
     /**
      * Recovers the nodal values for all regions.
+     * @param elementSet Set of elements defining the region.
      * @param type Determines the type of internal variable to be recovered.
      * @param tStep Time step.
      */
-    virtual int recoverValues(Set elementSet, InternalStateType type, TimeStep *tStep) = 0;
+    int recoverValues(Set &elementSet, InternalStateType type, TimeStep *tStep);
+    /**
+     * Recovers the nodal values of several internal variables in a single pass over region elements.
+     * Only the types not yet recovered for current region and solution state are computed.
+     * @param elementSet Set of elements defining the region.
+     * @param types Types of internal variables to be recovered.
+     * @param tStep Time step.
+     */
+    int recoverValues(Set &elementSet, const std :: vector< InternalStateType > &types, TimeStep *tStep);
     /**
-     * Clears the receiver's nodal table.
+     * Clears the receiver's nodal tables and data of all regions.
      * @return nonzero if o.k.
      */
     virtual int clear();
     /**
-     * Returns vector of recovered values for given node and region.
+     * Returns vector of recovered values for given node of the last recovered region.
      * @param ptr Pointer to recovered values at node, NULL if not present.
      * @param node Node number.
      * @return Nonzero if values are defined, zero otherwise.
      */
-    int giveNodalVector(const FloatArray * &ptr, int node);
+    int giveNodalVector(const FloatArray * &ptr, int node) { return this->giveNodalVector(ptr, node, this->valType); }
+    /**
+     * Returns vector of recovered values of given type for given node of the last recovered region.
+     * @param ptr Pointer to recovered values at node, NULL if not present.
+     * @param node Node number.
+     * @param type Type of recovered variable.
+     * @return Nonzero if values are defined, zero otherwise.
+     */
+    int giveNodalVector(const FloatArray * &ptr, int node, InternalStateType type);
     /**
      * Returns the region record size. Available after recovery.
      * @param reg Virtual region id.
@@ -126,23 +172,48 @@ public:
     std :: string errorInfo(const char *func) { return std :: string(this->giveClassName()) + func; }
 
 protected:
+    /**
+     * Recovers the nodal values of given types for current region (given by region).
+     * The results are stored using updateRegionRecoveredValues.
+     * @param elementSet Set of elements defining the region.
+     * @param types Types of internal variables to be recovered.
+     * @param tStep Time step.
+     * @return Nonzero if ok.
+     */
+    virtual int recoverRegionValues(Set &elementSet, const std :: vector< InternalStateType > &types, TimeStep *tStep) = 0;
+    /// Creates new (empty) region record; derived models return records extended by their region data.
+    virtual std :: unique_ptr< Region >createRegion() { return std :: make_unique< Region >(); }
+    /**
+     * Determines the region data, which do not depend on recovered values (patches, mass matrix, etc.).
+     * Called for new region or whenever the mesh changes, after the local region node numbering is determined.
+     * @param elementSet Set of elements defining the region.
+     */
+    virtual void initRegion(Set &elementSet) { }
+    /**
+     * Makes the region corresponding to given element set current. The region data are determined
+     * for new region, or if they do not correspond to current mesh (then the recovered values of region are discarded).
+     * @param elementSet Set of elements defining the region.
+     * @return Nonzero if ok, zero if region has to be skipped.
+     */
+    int checkRegion(Set &elementSet);
+
     /**
      * Determine local region node numbering and determine and check nodal values size.
      * @param regionNodalNumbers on Return array containing for each dofManager its local region number.
      * @param regionDofMans On output total number of region dofMans.
-     * @param reg Virtual region number.
+     * @param elementSet Set of elements defining the region.
      * @returns Nonzero if ok, zero if region has to be skipped.
      */
-    int initRegionNodeNumbering(IntArray &regionNodalNumbers, int &regionDofMans, Set &region);
+    int initRegionNodeNumbering(IntArray &regionNodalNumbers, int &regionDofMans, Set &elementSet);
 
     /**
      * Update the nodal table according to recovered solution for given region.
-     * @param ireg Virtual region number.
+     * @param type Type of recovered values.
      * @param regionNodalNumbers Array containing for each dofManager its local region number.
      * @param regionValSize Size of dofMan record.
      * @param rhs Array with recovered values.
      */
-    int updateRegionRecoveredValues(const IntArray &regionNodalNumbers,
+    int updateRegionRecoveredValues(InternalStateType type, const IntArray &regionNodalNumbers,
                                     int regionValSize, const FloatArray &rhs);
 };
 } // end namespace oofem
@@ -41,9 +41,11 @@
 #include "grid.h"
 #include "mathfem.h"
 #include "dynamicinputrecord.h"
+#include "statecountertype.h"
 
 #include <list>
 #include <memory>
+#include <vector>
 
 ///@name Input fields for NonlocalMaterialExtensionInterface
 //@{
@@ -66,6 +68,7 @@
 #define _IFT_NonlocalMaterialExtensionInterface_initdiag "initdiag"
 #define _IFT_NonlocalMaterialExtensionInterface_order "order"
 #define _IFT_NonlocalMaterialExtensionInterface_centdiff "centdiff"
+#define _IFT_NonlocalMaterialExtensionInterface_interactiontable "nltable"
 //@}
 
 namespace oofem {
@@ -82,6 +85,38 @@ struct localIntegrationRecord {
     double weight;
 };
 
+/**
+ * Nonlocal interactions of all integration points of a domain, stored in compressed row format.
+ * Rows and columns correspond to the integration points (of default integration rules) of elements
+ * taking part in averaging, numbered element by element. Each row keeps the influencing points
+ * and their integration weights (weight function times the volume around the influencing point),
+ * so that the nonlocal averages of all points are evaluated at once as a sparse matrix-vector product
+ * over the contiguous array of local values.
+ * @see NonlocalMaterialExtensionInterface::buildInteractionTable
+ */
+struct NonlocalInteractionTable {
+    /// Integration points in the order of rows (columns).
+    std :: vector< GaussPoint * >points;
+    /// Row of the first integration point of each element, -1 if element does not take part in averaging.
+    std :: vector< int >elementOffset;
+    /// Volumes around integration points.
+    std :: vector< double >volume;
+    /// Positions of rows in col and weight arrays.
+    std :: vector< int >rowPtr;
+    /// Influencing points (columns).
+    std :: vector< int >col;
+    /// Integration weights.
+    std :: vector< double >weight;
+    /// Sum of integration weights of each row.
+    std :: vector< double >scale;
+    /// Local values of averaged variable.
+    std :: vector< double >localValues;
+    /// Nonlocal averages (not scaled).
+    std :: vector< double >averages;
+    /// Solution state for which the averages have been evaluated, -1 if not evaluated (accessed atomically).
+    StateCounterType averageStateCounter = -1;
+};
+
 /**
  * Abstract base class for all nonlocal constitutive model statuses. Introduces the list of
  * localIntegrationRecords stored in each integration point, where references to all influencing
@@ -176,6 +211,12 @@ protected:
     IntArray regionMap;
     /// Flag indicating whether to keep nonlocal interaction tables of integration points cached.
     bool permanentNonlocTableFlag;
+    /// Flag indicating whether the interaction table of the domain may be used (if supported by material).
+    bool interactionTableFlag;
+    /// Interaction table of the domain, built on demand.
+    std :: unique_ptr< NonlocalInteractionTable >interactionTable;
+    /// Flag indicating that interactionTable has been built (accessed atomically, so that it can be tested outside of critical section).
+    bool interactionTableBuilt;
     /// Type characterizing the nonlocal weight function.
     enum WeightFunctionType { WFT_Unknown, WFT_Bell, WFT_Gauss, WFT_Green, WFT_Uniform, WFT_UniformOverElement, WFT_Green_21 };
     /// Parameter specifying the type of nonlocal weight function.
@@ -279,13 +320,88 @@ public:
      * is specified by element-specific type (like StructuralElement) corresponding to analysis type.
      * This service can be invoked multiple times, but update for specific material is done only once, because
      * last modification time mark is kept.
+     * Elements are updated concurrently (color by color, see Domain::giveElementColoring) if all nonlocal
+     * materials of the domain allow it.
      * @see Element::updateBeforeNonlocalAverage
      */
     void updateDomainBeforeNonlocAverage(TimeStep *tStep);
+    /**
+     * Returns true if the integration points of receiver can be updated before nonlocal average concurrently
+     * with other elements sharing no nodes. Formulations modifying the weight function (eikonal models)
+     * or the interaction radius work with data shared by all integration points and are processed serially.
+     */
+    virtual bool supportsConcurrentUpdateBeforeNonlocAverage() const
+    { return nlvar == NLVT_Standard && !( averType >= 2 && averType <= 6 ); }
+
+    /**
+     * Returns true if the receiver provides the local values of averaged variable by giveLocalVariableForAverage,
+     * so that the nonlocal averages can be evaluated using the interaction table of the domain.
+     */
+    virtual bool supportsInteractionTable() { return false; }
+    /**
+     * Returns the local value of the averaged variable in given integration point,
+     * as prepared by updateDomainBeforeNonlocAverage.
+     */
+    virtual double giveLocalVariableForAverage(GaussPoint *gp) { return 0.; }
+    /**
+     * Returns true if the nonlocal averages are evaluated using the interaction table of the domain.
+     * The table is used by materials supporting it, for standard (not modified) bounded weight functions
+     * with permanent interaction tables.
+     */
+    bool useInteractionTable();
+    /**
+     * Builds the interaction table of the domain (see NonlocalInteractionTable).
+     * The coordinates and volumes of integration points are evaluated once, the influencing points are
+     * searched in a uniform grid of cells with the size of support radius, and the rows are evaluated concurrently.
+     */
+    void buildInteractionTable();
+    /**
+     * Returns the row of interaction table corresponding to given integration point, the table is built if necessary.
+     * @return Row index, -1 if the interaction table is not used or does not contain given point.
+     */
+    int giveInteractionTableRow(GaussPoint *gp);
+    /**
+     * Returns the nonlocal average (sum of weighted local values, not scaled) in given row of interaction table.
+     * The averages of all points are evaluated at once, when requested for the first time in the solution state.
+     * @param row Row of interaction table.
+     * @param scale Sum of integration weights of the row.
+     * @param tStep Time step.
+     */
+    double giveNonlocalAverage(int row, double &scale, TimeStep *tStep);
+    /**
+     * Evaluates given function for all integration points in the integration domain of given point,
+     * with their integration weights. The row of interaction table is traversed directly, if the table is used for the point;
+     * otherwise the list of integration point is used (built if necessary).
+     * @param gp Integration point.
+     * @param f Function called with influencing integration point and its weight.
+     */
+    template< class Function >
+    void forEachIntegrationRecord(GaussPoint *gp, Function f)
+    {
+        int row = this->giveInteractionTableRow(gp);
+        if ( row >= 0 ) {
+            const NonlocalInteractionTable &table = * interactionTable;
+            for ( int k = table.rowPtr [ row ]; k < table.rowPtr [ row + 1 ]; k++ ) {
+                f(table.points [ table.col [ k ] ], table.weight [ k ]);
+            }
+        } else {
+            for ( auto &lir : * this->giveIPIntegrationList(gp) ) {
+                f(lir.nearGp, lir.weight);
+            }
+        }
+    }
+
+    /**
+     * Returns the number of integration points in the integration domain of given point, as already evaluated
+     * (in interaction table or integration list); the table and list are not built by this method.
+     */
+    int giveNumberOfIntegrationRecords(GaussPoint *gp);
 
     /**
      * Builds list of integration points which take part in nonlocal average in given integration point.
      * This list is stored in integration point corresponding nonlocal status.
+     * Points covered by the interaction table get no list (only their volume and integration scale are set),
+     * their integration domain is accessed by forEachIntegrationRecord.
      * Generally speaking, the nonlocal weight function with "bounded" or limited support is assumed.
      * When nonlocal weight function unbounded support is used, then keeping the list of
      * influencing integration points would be wasting of space and should be cleared after averaging has
@@ -334,6 +450,7 @@ public:
      * references to integration points and their weights that influence to nonlocal average in
      * receiver's associated integration point.
      * Rebuilds the IP list by calling  buildNonlocalPointTable if not available.
+     * For points of interaction table, the list is a copy of the table row, prefer forEachIntegrationRecord.
      */
     std :: vector< localIntegrationRecord > *giveIPIntegrationList(GaussPoint *gp);
 
@@ -413,6 +530,9 @@ public:
     void endIPNonlocalAverage(GaussPoint *gp);
 
 protected:
+    /// Updates all elements of domain before nonlocal average (see updateDomainBeforeNonlocAverage).
+    void updateDomainElements(TimeStep *tStep);
+
     /*
      * Returns true if the barrier is activated
      * by interaction of two given points. In this case the nonlocal influence
@@ -65,6 +65,17 @@ public:
      * receiver's associated integration point.
      */
     virtual std :: vector< localIntegrationRecord > *NonlocalMaterialStiffnessInterface_giveIntegrationDomainList(GaussPoint *gp) = 0;
+    /**
+     * Returns integration points that influence the nonlocal average in given integration point.
+     * The default implementation extracts them from integration list of receiver.
+     */
+    virtual void NonlocalMaterialStiffnessInterface_giveInfluencingPoints(std :: vector< GaussPoint * > &answer, GaussPoint *gp)
+    {
+        answer.clear();
+        for ( auto &lir : * this->NonlocalMaterialStiffnessInterface_giveIntegrationDomainList(gp) ) {
+            answer.push_back(lir.nearGp);
+        }
+    }
 
 #ifdef __OOFEG
     /**
@@ -0,0 +1,171 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef oofembindatareader_h
+#define oofembindatareader_h
+
+#include "datareader.h"
+#include "oofemtxtinputrecord.h"
+
+#include <vector>
+#include <memory>
+
+namespace oofem {
+class OOFEMTXTDataReader;
+
+/**
+ * Input record representing a block of consecutive records, which differ only in their number
+ * and in the values of a single numeric array field (typically node coordinates or element nodes).
+ * The remaining fields are shared and parsed only once per block. The record is positioned
+ * at one member of the block at a time.
+ */
+class OOFEM_EXPORT OOFEMBinaryInputRecord : public OOFEMTXTInputRecord
+{
+protected:
+    /// Keyword of all records in block.
+    std :: string keyword;
+    /// Name of the array field stored in bulk.
+    std :: string arrayField;
+    /// Fields common to all records in block.
+    std :: string sharedFields;
+    /// Size of array field of each record.
+    int arraySize;
+    /// Record numbers.
+    std :: vector< int >numbers;
+    /// Integer array values, used when all values are integers.
+    std :: vector< int >intValues;
+    /// Floating point array values.
+    std :: vector< double >doubleValues;
+    /// Current position in block.
+    int current;
+    /// Flag indicating that the shared fields were checked for unread tokens.
+    bool finished;
+
+public:
+    /**
+     * Constructor.
+     * @param lineNumber Line number of first record (used in error messages).
+     * @param keyword Record keyword.
+     * @param arrayField Name of bulk array field.
+     * @param arraySize Size of bulk array field.
+     * @param shared Remaining fields common to all records.
+     */
+    OOFEMBinaryInputRecord(int lineNumber, std :: string keyword, std :: string arrayField, int arraySize, const std :: string &shared);
+
+    /// Returns number of records in block.
+    int giveNumberOfRecords() const { return (int)numbers.size(); }
+    /// Positions the record at given member (0-based).
+    void setCurrent(int i) { current = i; }
+    /// Gives access to the record numbers.
+    std :: vector< int > &giveNumbers() { return numbers; }
+    /// Gives access to the integer values, array values of i-th record are stored at i*arraySize.
+    std :: vector< int > &giveIntValues() { return intValues; }
+    /// Gives access to the floating point values, array values of i-th record are stored at i*arraySize.
+    std :: vector< double > &giveDoubleValues() { return doubleValues; }
+    const std :: string &giveKeyword() const { return keyword; }
+
+    std :: unique_ptr< InputRecord >clone() override;
+    std :: string giveRecordAsString() const override;
+    void finish(bool wrn = true) override;
+
+    IRResultType giveRecordKeywordField(std :: string &answer, int &value) override;
+    IRResultType giveRecordKeywordField(std :: string &answer) override;
+    IRResultType giveField(FloatArray &answer, InputFieldType id) override;
+    IRResultType giveField(IntArray &answer, InputFieldType id) override;
+    bool hasField(InputFieldType id) override;
+    // avoid hiding of remaining overloads
+    using OOFEMTXTInputRecord :: giveField;
+};
+
+
+/**
+ * Class representing the implementation of binary data reader.
+ * The binary input file contains the same sequence of input records as the text input file, but
+ * consecutive records differing only in record number and in single numeric array field (nodes with
+ * their coordinates, elements with their nodes) are stored in bulk blocks of binary numbers,
+ * which are read without any tokenization. Other records are stored as text and tokenized in parallel.
+ * Binary files are created from text input files by convertTextFile (available as oofem -wb option).
+ *
+ * The file layout (native byte order) is: magic string, format version, output file name, description,
+ * number of entries and the entries themselves. Each entry is either a text record
+ * (line number, record string) or a block (line number, keyword, array field name, array size, shared fields,
+ * record count, integer flag, record numbers and array values).
+ * The error checking rules of the text file (see ErrorCheckingExportModule) are appended as plain text lines,
+ * so that they are found in the binary file as well.
+ */
+class OOFEM_EXPORT OOFEMBinaryDataReader : public DataReader
+{
+protected:
+    std :: string dataSourceName;
+    /// Text records.
+    std :: vector< OOFEMTXTInputRecord >textRecords;
+    /// Bulk blocks.
+    std :: vector< std :: unique_ptr< OOFEMBinaryInputRecord > >blocks;
+    /// Sequence of entries, negative values are blocks (-1-index), non-negative are text records.
+    std :: vector< int >entries;
+    /// Current entry.
+    std :: size_t entry;
+    /// Current position within block entry.
+    int position;
+
+public:
+    /// Constructor.
+    OOFEMBinaryDataReader(std :: string inputfilename);
+    virtual ~OOFEMBinaryDataReader();
+
+    OOFEMBinaryDataReader(const OOFEMBinaryDataReader &src) = delete;
+    OOFEMBinaryDataReader &operator = ( const OOFEMBinaryDataReader &src ) = delete;
+
+    InputRecord *giveInputRecord(InputRecordType, int recordId) override;
+    bool peakNext(const std :: string &keyword) override;
+    int giveRunLength(int maxCount) override;
+    void finish() override;
+    std :: string giveReferenceName() const override { return dataSourceName; }
+
+    /// Returns true if given file is in binary input format.
+    static bool isBinaryFile(const std :: string &filename);
+    /**
+     * Converts text input file into binary one.
+     * @param txtFileName Name of text input file.
+     * @param binFileName Name of binary file to create.
+     */
+    static void convertTextFile(const std :: string &txtFileName, const std :: string &binFileName);
+
+protected:
+    /// Returns the next input record without advancing.
+    InputRecord *giveCurrentRecord();
+};
+} // end namespace oofem
+#endif // oofembindatareader_h
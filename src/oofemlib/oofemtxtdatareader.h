@@ -39,6 +39,7 @@
 #include "oofemtxtinputrecord.h"
 
 #include <fstream>
+#include <vector>
 
 namespace oofem {
 /**
@@ -53,10 +54,10 @@ class OOFEM_EXPORT OOFEMTXTDataReader : public DataReader
 {
 protected:
     std :: string dataSourceName;
-    std :: list< OOFEMTXTInputRecord > recordList;
+    std :: vector< OOFEMTXTInputRecord > recordList;
 
     /// Keeps track of the current position in the list
-    std :: list< OOFEMTXTInputRecord > :: iterator it;
+    std :: vector< OOFEMTXTInputRecord > :: iterator it;
 
 public:
     /// Constructor.
@@ -66,8 +67,11 @@ public:
 
     InputRecord *giveInputRecord(InputRecordType, int recordId) override;
     bool peakNext(const std :: string &keyword) override;
+    int giveRunLength(int maxCount) override;
     void finish() override;
     std :: string giveReferenceName() const override { return dataSourceName; }
+    /// Returns true if there are unread records left.
+    bool hasNextRecord() const { return it != recordList.end(); }
 
 protected:
     /**
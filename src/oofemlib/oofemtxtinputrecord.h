@@ -105,6 +105,7 @@ public:
     void report_error(const char *_class, const char *proc, InputFieldType id,
                       IRResultType result, const char *file, int line) override;
     void setLineNumber(int lineNumber) { this->lineNumber = lineNumber; }
+    int giveLineNumber() const { return this->lineNumber; }
 
 protected:
     int giveKeywordIndx(const char *kwd);
@@ -0,0 +1,100 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef poolallocator_h
+#define poolallocator_h
+
+#include "oofemcfg.h"
+
+#include <cstddef>
+
+namespace oofem {
+/**
+ * Thread local cache of memory blocks, used to back the storage of small dynamic arrays
+ * (FloatArray, FloatMatrix, IntArray). Requests are rounded up to power of two size classes; released blocks are
+ * kept in per-thread free lists of corresponding class and reused by subsequent requests.
+ * Temporary arrays created and destroyed repeatedly in element and material kernels are thus served
+ * without calling the global allocator, which avoids both the allocation cost and the contention of
+ * the global allocator in parallel loops.
+ *
+ * Blocks larger than MaxBlockSize bytes are allocated directly, as well as blocks requested when
+ * the cache of given class is full. Blocks may be released by other thread than the one which allocated them.
+ */
+class OOFEM_EXPORT MemoryPool
+{
+public:
+    /// Size of smallest size class in bytes.
+    static const std :: size_t MinBlockSize = 64;
+    /// Size of largest cached size class in bytes.
+    static const std :: size_t MaxBlockSize = 32768;
+    /// Maximum number of blocks kept in free list of one size class (per thread).
+    static const int MaxCachedBlocks = 64;
+
+    /// Allocates block of at least given size, never returns null (not even for zero size).
+#ifdef __GNUC__
+    __attribute__( ( returns_nonnull ) )
+#endif
+    static void *allocate(std :: size_t bytes);
+    /// Releases block allocated by allocate with the same size.
+    static void deallocate(void *ptr, std :: size_t bytes) noexcept;
+    /// Releases all blocks cached by calling thread.
+    static void releaseCache() noexcept;
+};
+
+
+/**
+ * Allocator for standard containers, using MemoryPool.
+ * Stateless, all instances are interchangeable.
+ */
+template< typename T >
+class PoolAllocator
+{
+public:
+    typedef T value_type;
+
+    PoolAllocator() noexcept { }
+    template< typename U >
+    PoolAllocator(const PoolAllocator< U > &) noexcept { }
+
+    T *allocate(std :: size_t n) { return static_cast< T * >( MemoryPool :: allocate( n * sizeof( T ) ) ); }
+    void deallocate(T *ptr, std :: size_t n) noexcept { MemoryPool :: deallocate( ptr, n * sizeof( T ) ); }
+};
+
+template< typename T, typename U >
+bool operator == (const PoolAllocator< T > &, const PoolAllocator< U > &) { return true; }
+template< typename T, typename U >
+bool operator != (const PoolAllocator< T > &, const PoolAllocator< U > &) { return false; }
+} // end namespace oofem
+#endif // poolallocator_h
@@ -80,18 +80,28 @@ protected:
      * matrix, if there is no change;
      */
     SparseMtrxVersionType version;
+    /**
+     * Fingerprint (hash) of the sparsity pattern, set when the internal structure is built (zero if not available).
+     * Allows the solvers to reuse the ordering and symbolic factorization for matrices with unchanged structure.
+     */
+    std :: size_t patternFingerprint;
 
 public:
     /**
      * Constructor, creates (n,m) sparse matrix. Due to sparsity character of matrix,
      * not all coefficient are physically stored (in general, zero members are omitted).
      */
-    SparseMtrx(int n=0, int m=0) : nRows(n), nColumns(m), version(0) { }
+    SparseMtrx(int n=0, int m=0) : nRows(n), nColumns(m), version(0), patternFingerprint(0) { }
     /// Destructor
     virtual ~SparseMtrx() { }
 
     /// Return receiver version.
     SparseMtrxVersionType giveVersion() { return this->version; }
+    /**
+     * Returns the fingerprint of receiver sparsity pattern. Matrices of the same type with equal fingerprints have
+     * (with high probability) the same structure. Zero value means that the fingerprint is not available.
+     */
+    std :: size_t givePatternFingerprint() const { return this->patternFingerprint; }
 
     /**
      * Checks size of receiver towards requested bounds.
@@ -143,8 +153,8 @@ public:
      */
     virtual void timesT(const FloatArray &x, FloatArray &answer) const { OOFEM_ERROR("Not implemented"); }
     /**
-     * Evaluates @f$ C = A^{\mathrm{T}} \cdot B @f$
-     * @param B Array to be multiplied with receiver.
+     * Evaluates @f$ C = A \cdot B @f$
+     * @param B Matrix to be multiplied with receiver.
      * @param answer C.
      */
     virtual void times(const FloatMatrix &B, FloatMatrix &answer) const { OOFEM_ERROR("Not implemented"); }
@@ -236,6 +246,13 @@ public:
     virtual int assembleBegin() { return 1; }
     /// Returns when assemble is completed.
     virtual int assembleEnd() { return 1; }
+    /**
+     * Returns true if receiver accepts concurrent calls of assemble from several threads,
+     * provided that the concurrently assembled contributions never address the same coefficient
+     * (i.e. they come from elements sharing no dof managers, see ElementColoring).
+     * The internal structure has to be built in advance.
+     */
+    virtual bool supportsConcurrentAssembly() const { return false; }
 
     /// Determines, whether receiver can be factorized.
     virtual bool canBeFactorized() const = 0;
@@ -303,6 +320,25 @@ public:
         return answer;
     }
     //@}
+
+    /**
+     * Adds the given values to pattern fingerprint (FNV-1a hash).
+     * @param hash Hash of preceding values, zero to start new fingerprint.
+     * @param begin Begin of values.
+     * @param end End of values.
+     * @return Updated hash.
+     */
+    template< class Iterator >
+    static std :: size_t hashPattern(std :: size_t hash, Iterator begin, Iterator end)
+    {
+        if ( hash == 0 ) {
+            hash = ( std :: size_t ) 14695981039346656037ULL;
+        }
+        for ( ; begin != end; ++begin ) {
+            hash = ( hash ^ ( std :: size_t ) * begin ) * ( std :: size_t ) 1099511628211ULL;
+        }
+        return hash;
+    }
 };
 } // end namespace oofem
 #endif // sparsemtrx_h
@@ -50,7 +50,9 @@ enum SparseMtrxType {
     SMT_PetscMtrx,     ///< PETSc library mtrx representation.
     SMT_DSS_sym_LDL,   ///< Richard Vondracek's sparse direct solver.
     SMT_DSS_sym_LL,    ///< Richard Vondracek's sparse direct solver.
-    SMT_DSS_unsym_LU   ///< Richard Vondracek's sparse direct solver.
+    SMT_DSS_unsym_LU,  ///< Richard Vondracek's sparse direct solver.
+    SMT_Supernodal,    ///< Symmetric compressed column with supernodal LDL^T factorization.
+    SMT_BSR            ///< Block compressed row, blocks given by dof managers.
 };
 } // end namespace oofem
 #endif // sparsematrixtype_h
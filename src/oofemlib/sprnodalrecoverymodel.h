@@ -37,6 +37,7 @@
 
 #include "nodalrecoverymodel.h"
 #include "interface.h"
+#include "floatmatrix.h"
 
 #define _IFT_SPRNodalRecoveryModel_Name "spr"
 
@@ -76,16 +77,42 @@ protected:
             dofManValues(a), dofManPatchCount(b), regionNodalNumbers(c), regionValSize(d) { }
     };
 
+    /// Patch of elements surrounding patch assembly point.
+    struct Patch {
+        /// Positions of patch elements in region.
+        IntArray elements;
+        /// Dof managers, which values are determined from the patch.
+        IntArray dofManToDetermine;
+        /// Matrix of least square fit (sum of products of polynomial terms in integration points).
+        FloatMatrix A;
+    };
+
+    /// Region data of SPR recovery; they depend only on region and are kept for all recoveries on it.
+    struct SPRRegion : public Region {
+        /// Patch type of region.
+        SPRPatchType patchType;
+        /// Patches of region.
+        std :: vector< Patch >patches;
+        /// Polynomial terms in integration points (rows) of region elements (empty for unsupported elements).
+        std :: vector< FloatMatrix >elementTerms;
+
+        SPRRegion() : Region(), patchType(SPRPatchType_none), patches(), elementTerms() { }
+    };
+
 public:
     /// Constructor.
     SPRNodalRecoveryModel(Domain * d);
     /// Destructor.
     virtual ~SPRNodalRecoveryModel();
 
-    int recoverValues(Set elementSet, InternalStateType type, TimeStep *tStep) override;
-
     const char *giveClassName() const override { return "SPRNodalRecoveryModel"; }
 
+protected:
+    int recoverRegionValues(Set &elementSet, const std :: vector< InternalStateType > &types, TimeStep *tStep) override;
+    std :: unique_ptr< Region >createRegion() override { return std :: make_unique< SPRRegion >(); }
+    /// Determines the patches of region and the least square fit matrices.
+    void initRegion(Set &elementSet) override;
+
 private:
     /**
      * Initializes the region table indicating regions to skip.
@@ -98,11 +125,10 @@ private:
 
     void determinePatchAssemblyPoints(IntArray &pap, SPRPatchType regType, Set &elemset);
     void initPatch(IntArray &patchElems, IntArray &dofManToDetermine, IntArray &pap, int papNumber, Set &elementList);
-    void computePatch(FloatMatrix &a, IntArray &patchElems, int &regionValSize,
-                      SPRPatchType regType, InternalStateType type, TimeStep *tStep);
+    void computePatch(FloatMatrix &a, const Patch &patch, const std :: vector< FloatMatrix > &ipValues, int size);
     void determineValuesFromPatch(FloatArray &dofManValues, IntArray &dofManCount,
-                                  IntArray &regionNodalNumbers, IntArray &dofManToDetermine,
-                                  FloatMatrix &a, SPRPatchType type);
+                                  const IntArray &regionNodalNumbers, const IntArray &dofManToDetermine,
+                                  const FloatMatrix &a, SPRPatchType type);
     void computePolynomialTerms(FloatArray &P, const FloatArray &coords, SPRPatchType type);
     int  giveNumberOfUnknownPolynomialCoefficients(SPRPatchType regType);
     SPRPatchType determinePatchType(Set &elementList);
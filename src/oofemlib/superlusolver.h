@@ -40,6 +40,8 @@
 #include "floatarray.h"
 #include "SUPERLU_MT/include/slu_mt_ddefs.h"
 
+#include <vector>
+
 #define _IFT_SuperLUSolver_Name "superlu"
 
 namespace oofem {
@@ -57,6 +59,10 @@ class FloatMatrix;
 class OOFEM_EXPORT SuperLUSolver : public SparseLinearSystemNM
 {
 private:
+    /// Column permutation computed for the last matrix structure.
+    std :: vector< int_t >permCache;
+    /// Pattern fingerprint of the matrix, for which the column permutation has been computed.
+    std :: size_t permFingerprint;
 
 public:
     SuperLUSolver(Domain * d, EngngModel * m);
@@ -0,0 +1,172 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef supernodalmtrx_h
+#define supernodalmtrx_h
+
+#include "symcompcol.h"
+
+#include <vector>
+#include <memory>
+
+namespace oofem {
+/**
+ * Symmetric sparse matrix with supernodal LDL^T factorization.
+ * The matrix itself is stored and assembled as SymCompCol (lower part in compressed column format),
+ * the factor is kept separately, so the matrix values remain available (e.g., for matrix-vector products)
+ * after the factorization.
+ *
+ * The symbolic factorization is computed on first factorization after the internal structure is built:
+ * the equations are reordered by nested dissection (see GraphOrdering), the elimination tree is computed and
+ * postordered and columns with identical structure are grouped into (fundamental) supernodes.
+ * The factor of each supernode is stored as dense column-major block, containing the diagonal block and
+ * all its nonzero rows below.
+ * The symbolic factorization depends only on the structure; it is kept when the internal structure is rebuilt
+ * unchanged (e.g., in the next time step) and the last few are cached, so that other matrices with the same structure
+ * (such as RVE problems) only repeat the numeric factorization.
+ *
+ * The numeric factorization is left-looking: each supernode first gathers the updates from its descendants
+ * in the elimination tree and then factorizes its dense block. As a supernode only modifies its own block,
+ * the supernodes are processed level by level (grouped by height in the supernodal elimination tree) and the
+ * supernodes within one level are factorized in parallel (OpenMP). For levels with single supernode (the
+ * top separators), the dense kernels are parallelized instead.
+ * No pivoting is performed, the matrix is assumed to be positive definite or at least strongly regular.
+ */
+class OOFEM_EXPORT SupernodalMtrx : public SymCompCol
+{
+public:
+    /**
+     * Ordering and symbolic factorization of given sparsity pattern.
+     * Once computed, it is never modified, so it can be shared by several matrices (and factorizations)
+     * with the same structure.
+     */
+    struct SymbolicFactorization {
+        /// Fingerprint of the pattern.
+        std :: size_t fingerprint;
+        /// Column pointers of the pattern (used to verify the match of fingerprints).
+        IntArray colptr;
+        /// Row indices of the pattern.
+        IntArray rowind;
+        /// Permutation of equations (perm[i] is the original equation at position i, 0-based).
+        std :: vector< int >perm;
+        /// Inverse permutation.
+        std :: vector< int >iperm;
+        /// First column of each supernode (with extra entry equal to number of equations).
+        std :: vector< int >snStart;
+        /// Supernode of each (permuted) column.
+        std :: vector< int >colSupernode;
+        /// Positions of supernode row indices in snRows.
+        std :: vector< int >snRowPtr;
+        /// Row indices (permuted) of supernodes, starting with the supernode columns.
+        std :: vector< int >snRows;
+        /// Positions of supernode blocks in factor.
+        std :: vector< std :: size_t >snValPtr;
+        /// Positions of updating supernodes in updSupernode and updRow.
+        std :: vector< int >updPtr;
+        /// Descendant supernodes updating the supernode.
+        std :: vector< int >updSupernode;
+        /// Position of first row of updating supernode belonging to updated supernode.
+        std :: vector< int >updRow;
+        /// Positions of levels in levelSupernodes.
+        std :: vector< int >levelPtr;
+        /// Supernodes sorted by height in elimination tree.
+        std :: vector< int >levelSupernodes;
+        /// Position of each matrix value in factor.
+        std :: vector< std :: size_t >valueMap;
+    };
+
+protected:
+    /// Symbolic factorization of current structure (null if not yet computed).
+    std :: shared_ptr< const SymbolicFactorization >symbolic;
+    /// Factor, dense blocks of supernodes (unit lower triangle with D on diagonal).
+    std :: vector< double >factor;
+    /// Flag indicating whether factorized.
+    bool isFactorized;
+    /// Version of matrix values, which have been factorized.
+    SparseMtrxVersionType factorVersion;
+
+public:
+    /**
+     * Constructor.
+     * Before any operation an internal profile must be built.
+     * @param n Size of matrix
+     * @see buildInternalStructure
+     */
+    SupernodalMtrx(int n=0);
+    /// Copy constructor
+    SupernodalMtrx(const SupernodalMtrx & S);
+    /// Destructor
+    virtual ~SupernodalMtrx() { }
+
+    std::unique_ptr<SparseMtrx> clone() const override;
+    int buildInternalStructure(EngngModel *, int, const UnknownNumberingScheme &) override;
+    bool canBeFactorized() const override { return true; }
+    SparseMtrx *factorized() override;
+    FloatArray *backSubstitutionWith(FloatArray &y) const override;
+    const char* giveClassName() const override { return "SupernodalMtrx"; }
+    SparseMtrxType giveType() const  override { return SMT_Supernodal; }
+
+    /// Returns number of nonzero entries in factor (including explicitly stored zeros in supernode blocks).
+    std :: size_t giveFactorSize() const { return symbolic ? symbolic->snValPtr.back() : 0; }
+
+protected:
+    /// Checks whether the given symbolic factorization has been computed for the structure of receiver.
+    bool hasStructureOf(const SymbolicFactorization &sf) const;
+    /**
+     * Computes the ordering and the symbolic factorization of current structure.
+     * The last few symbolic factorizations are cached, so matrices rebuilt with unchanged structure
+     * (in subsequent steps, or the same structure assembled for other problems) only repeat the numeric factorization.
+     */
+    void computeSymbolicFactorization();
+    /**
+     * Computes elimination tree of matrix permuted by sf.perm.
+     * @param sf Symbolic factorization with permutation.
+     * @param ptr Adjacency pointers of matrix graph.
+     * @param adj Adjacency of matrix graph.
+     * @param parent Parent of each column (-1 for roots).
+     */
+    void computeEliminationTree(const SymbolicFactorization &sf, const std :: vector< int > &ptr, const std :: vector< int > &adj, std :: vector< int > &parent) const;
+    /**
+     * Factorizes single supernode.
+     * @param s Supernode.
+     * @param map Work array mapping rows to supernode block rows (size equal to number of equations).
+     * @param work Work array.
+     * @param parallel Determines whether the dense kernels should be run in parallel.
+     * @return Zero based index of equation with zero pivot, -1 on success.
+     */
+    int factorizeSupernode(int s, std :: vector< int > &map, std :: vector< double > &work, bool parallel);
+};
+} // end namespace oofem
+#endif // supernodalmtrx_h
@@ -32,48 +32,32 @@
  *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
-#ifndef pair_h
-#define pair_h
 
-#include <cstdio>
+#ifndef supernodalsolver_h
+#define supernodalsolver_h
+
+#include "ldltfact.h"
+
+#define _IFT_SupernodalSolver_Name "supernodal"
 
 namespace oofem {
 /**
- * This class implements key/value associations - the key and its associated value.
- * An instance of Pair is used as an entry in a dictionary.
- * Pair has three components - its key, its value and pointer to the next Pair in the dictionary.
- *
- * Tasks:
- * - Returning its key, or its value, or the next pair ;
- * - Appending another pair to itself.
- *
+ * Direct solver using supernodal LDL^T factorization of SupernodalMtrx.
+ * The solution itself is the same as in LDLTFactorization (any sparse matrix supporting factorization can be used),
+ * the supernodal storage is recommended for symmetric problems.
+ * Unsymmetric problems fall back to unsymmetric skyline.
  */
-class OOFEM_EXPORT Pair
+class OOFEM_EXPORT SupernodalSolver : public LDLTFactorization
 {
-private:
-    /// Key.
-    int key;
-    /// Associate value.
-    double value;
-    /// Pointer to the next Pair.
-    Pair *next;
-
 public:
-    /// Constructor - creates the new Pair with given key k and value v.
-    Pair(int k, double v) : key(k), value(v), next(NULL) { }
+    /// Constructor - creates new instance of SupernodalSolver, belonging to domain d and Engngmodel m.
+    SupernodalSolver(Domain * d, EngngModel * m);
     /// Destructor
-    ~Pair() { }
+    virtual ~SupernodalSolver() { }
 
-    /// Appends a given pair to itself (sets the pointer to next pair to given Pair).
-    void append(Pair *p) { next = p; }
-    /// Returns the receiver key.
-    int giveKey() { return key; }
-    /// Returns pointer to the next pair.
-    Pair *giveNext() { return next; }
-    /// Returns associated value.
-    double &giveValue() { return value; }
-    /// Prints receiver to screen.
-    void printYourself() { printf("   Pair (%d,%f)\n", key, value); }
+    const char *giveClassName() const override { return "SupernodalSolver"; }
+    LinSystSolverType giveLinSystSolverType() const override { return ST_Supernodal; }
+    SparseMtrxType giveRecommendedMatrix(bool symmetric) const override { return symmetric ? SMT_Supernodal : SMT_SkylineU; }
 };
 } // end namespace oofem
-#endif // pair_h
+#endif // supernodalsolver_h
@@ -96,6 +96,8 @@ public:
     std::unique_ptr<SparseMtrx> clone() const override;
     void times(const FloatArray &x, FloatArray &answer) const override;
     void timesT(const FloatArray &x, FloatArray &answer) const override { this->times(x, answer); }
+    void times(const FloatMatrix &B, FloatMatrix &answer) const override;
+    void timesT(const FloatMatrix &B, FloatMatrix &answer) const override { this->times(B, answer); }
     void times(double x) override;
     int buildInternalStructure(EngngModel *, int, const UnknownNumberingScheme &) override;
     int assemble(const IntArray &loc, const FloatMatrix &mat) override;
@@ -38,6 +38,8 @@
 #include "oofemcfg.h"
 
 #include <chrono>
+#include <vector>
+#include <string>
 
 namespace oofem {
 /**
@@ -94,6 +96,14 @@ private:
  * Timer class, assumed to be an attribute of engineering model, serving stop-watch facility for engineering model.
  * It can handle several timers independently, each corresponding to different solution stage, etc.
  * Each timer is capable to track elapsed wall clock time as well as user time.
+ *
+ * In addition, the timer provides hierarchical profiling of solution phases (assembly, linear solve, etc.).
+ * Profiled regions are opened and closed by beginRegion and endRegion (or by ScopedRegion objects),
+ * regions opened within other region form its sub-regions. Region wall clock times and numbers of calls,
+ * together with counters attached to regions, are accumulated separately for each thread and each solution step.
+ * The results are written in JSON format; optionally, the individual region events can be recorded and written in
+ * Chrome trace event format (to be viewed by chrome://tracing or Perfetto).
+ * Profiling is off by default and the instrumentation then reduces to a single test.
  */
 class OOFEM_EXPORT EngngModelTimer
 {
@@ -115,12 +125,101 @@ public:
         EMTT_LastTimer
     };
 
+    /// Profiling modes.
+    enum ProfileMode {
+        PM_Off,     ///< No profiling.
+        PM_Summary, ///< Region times and counters, aggregated per solution step and thread.
+        PM_Trace,   ///< Summary and individual region events.
+    };
+
+    /**
+     * Profiled region, open for the lifetime of the object.
+     * Intended for instrumentation of code blocks, e.g.
+     * @code
+     * EngngModelTimer :: ScopedRegion region(this->timer, "assembly");
+     * @endcode
+     */
+    class ScopedRegion
+    {
+        EngngModelTimer *timer;
+
+    public:
+        /**
+         * Opens the region.
+         * @param t Timer to use (region is ignored if profiling is off).
+         * @param name Region name, the string has to exist for the whole analysis (typically literal).
+         */
+        ScopedRegion(EngngModelTimer &t, const char *name) : timer(t.isProfiling() ? & t : nullptr) {
+            if ( timer ) {
+                timer->beginRegion(name);
+            }
+        }
+        ~ScopedRegion() {
+            if ( timer ) {
+                timer->endRegion();
+            }
+        }
+        ScopedRegion(const ScopedRegion &) = delete;
+        ScopedRegion &operator = (const ScopedRegion &) = delete;
+    };
+
 protected:
+    typedef std :: chrono :: time_point< std :: chrono :: high_resolution_clock >TimePoint;
+
+    /// Node of region tree of a thread.
+    struct ProfileRegion {
+        /// Region name.
+        const char *name;
+        /// Index of parent region (-1 for root).
+        int parent;
+        /// Indices of sub-regions.
+        std :: vector< int >children;
+        /// True, if the node is counter rather than timed region.
+        bool counter;
+        /// Wall clock time (in seconds) in current step and in total.
+        double stepTime, totalTime;
+        /// Number of calls (or counter value) in current step and in total.
+        long stepCount, totalCount;
+    };
+
+    /// Completed region, recorded in trace mode.
+    struct TraceEvent {
+        int region;
+        double start, duration;
+    };
+
+    /// Profiling data of single thread.
+    struct ThreadProfile {
+        /// Region tree, the first node is the root.
+        std :: vector< ProfileRegion >regions;
+        /// Currently open region.
+        int current;
+        /// Start times of open regions.
+        std :: vector< TimePoint >starts;
+        /// Recorded events.
+        std :: vector< TraceEvent >events;
+    };
+
+    /// Aggregated data of one region in one solution step.
+    struct StepRecord {
+        int step, thread, region;
+        double time;
+        long count;
+    };
+
     /// Array of Timer classes.
     Timer timers [ EMTT_LastTimer ];
+    /// Profiling mode.
+    ProfileMode profileMode;
+    /// Profiles of individual threads.
+    std :: vector< ThreadProfile >threadProfiles;
+    /// Aggregated data of finished solution steps.
+    std :: vector< StepRecord >stepRecords;
+    /// Start of profiling.
+    TimePoint profileStart;
 
 public:
-    EngngModelTimer() { }
+    EngngModelTimer() : profileMode(PM_Off) { }
     ~EngngModelTimer() { }
 
     /**@name Profiling routines. */
@@ -130,6 +229,34 @@ public:
     void pauseTimer(EngngModelTimerType t) { timers [ t ].pauseTimer(); }
     void resumeTimer(EngngModelTimerType t) { timers [ t ].resumeTimer(); }
     void initTimer(EngngModelTimerType t) { timers [ t ].initTimer(); }
+
+    /// Sets the profiling mode, clears all profiling data.
+    void setProfileMode(ProfileMode mode);
+    /// Returns true if profiling is on.
+    bool isProfiling() const { return profileMode != PM_Off; }
+    /**
+     * Opens profiled region as a sub-region of the currently open region of the calling thread.
+     * @param name Region name, the string has to exist for the whole analysis (typically literal).
+     */
+    void beginRegion(const char *name);
+    /// Closes the currently open region of the calling thread.
+    void endRegion();
+    /**
+     * Adds the given value to counter of the currently open region of the calling thread.
+     * @param name Counter name, the string has to exist for the whole analysis (typically literal).
+     * @param n Value to add.
+     */
+    void addCount(const char *name, long n = 1);
+    /**
+     * Stores the data accumulated since previous call as data of given solution step.
+     * @param stepNumber Solution step number.
+     */
+    void finishProfileStep(int stepNumber);
+    /**
+     * Writes the profiling data into file baseName.profile.json and, in trace mode, the region events
+     * into file baseName.trace.json.
+     */
+    void writeProfile(const std :: string &baseName);
     //@}
 
     /**@name Reporting routines. */
@@ -145,6 +272,14 @@ public:
     /// Printing & formatting.
     void toString(EngngModelTimerType t, char *buff);
     //@}
+
+protected:
+    /// Returns the profile of the calling thread (NULL if not available).
+    ThreadProfile *giveThreadProfile();
+    /// Returns the index of sub-region of given name, created if not present.
+    int giveSubRegion(ThreadProfile &profile, const char *name, bool counter);
+    /// Returns the path of region (names of regions from root, separated by slash).
+    std :: string giveRegionPath(const ThreadProfile &profile, int region) const;
 };
 } // end namespace oofem
 #endif // timer_h
@@ -82,8 +82,6 @@ protected:
 
     /// Smoother type.
     NodalRecoveryModel :: NodalRecoveryModelType stype;
-    /// Smoother.
-    std::unique_ptr<NodalRecoveryModel> smoother;
     /// List of regions to skip.
     IntArray regionsToSkip;
 
@@ -102,7 +100,7 @@ public:
     const char *giveInputRecordName() const { return _IFT_VTKExportModule_Name; }
 
 protected:
-    /// Returns the internal smoother.
+    /// Returns the smoother (shared with other export modules, see Domain :: giveNodalRecoveryModel).
     NodalRecoveryModel *giveSmoother();
 
     /// Returns the output stream for given solution step.
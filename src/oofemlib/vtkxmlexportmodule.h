@@ -51,6 +51,7 @@
 
 #include <string>
 #include <list>
+#include <vector>
 
 ///@name Input fields for VTK XML export module
 //@{
@@ -62,6 +63,7 @@
 #define _IFT_VTKXMLExportModule_ipvars "ipvars"
 #define _IFT_VTKXMLExportModule_stype "stype"
 #define _IFT_VTKXMLExportModule_particleexportflag "particleexportflag"
+#define _IFT_VTKXMLExportModule_format "format"
 //@}
 
 namespace oofem {
@@ -134,15 +136,43 @@ private:
 };
 
 
+/**
+ * Vtu file being written: the output stream and the binary data of its appended section.
+ * It is kept apart from the export module, so that a deferred step can be written while the module sets up the next one.
+ */
+struct VTKXMLFile
+{
+    /// Output stream.
+    FILE *stream;
+    /// Binary data of all data arrays of the file, written at its end (appended formats only).
+    std :: vector< unsigned char >appendedData;
+    /// Position of the data array being written in appendedData.
+    std :: size_t dataArrayStart;
+
+    VTKXMLFile() : stream(NULL), appendedData(), dataArrayStart(0) { }
+};
+
 /**
  * Represents VTK (Visualization Toolkit) export module. It uses VTK (.vtu) file format, Unstructured grid dataset.
  * The export of data is done on Region By Region basis, possibly taking care about possible nonsmooth character of
  * some internal variables at region boundaries.
  * Each region is usually exported as a single piece. When region contains composite cells, these are assumed to be
  * exported in individual subsequent pieces after the default one for the particular region.
+ *
+ * The data arrays are written either as ascii text (default) or, when requested by the format keyword, as raw binary
+ * data stored in the appended data section at the end of the file. The appended data can be further compressed
+ * by zlib, if oofem is compiled with zlib support (otherwise uncompressed binary data are written).
  */
 class OOFEM_EXPORT VTKXMLExportModule : public ExportModule
 {
+public:
+    /// Format of exported data arrays.
+    enum VTKDataFormat {
+        VTKDF_ASCII = 0,      ///< Inline ascii data.
+        VTKDF_Appended = 1,   ///< Raw binary data in appended section.
+        VTKDF_Compressed = 2, ///< Zlib compressed binary data in appended section.
+    };
+
 protected:
     /// List of InternalStateType values, identifying the selected vars for export.
     IntArray internalVarsToExport;
@@ -160,14 +190,13 @@ protected:
 
     /// Smoother type.
     NodalRecoveryModel :: NodalRecoveryModelType stype;
-    /// Smoother.
-    std::unique_ptr<NodalRecoveryModel> smoother;
-    /// Smoother for primary variables.
-    std::unique_ptr<NodalRecoveryModel> primVarSmoother;
 
     /// particle export flag
     bool particleExportFlag;
 
+    /// Format of data arrays.
+    VTKDataFormat dataFormat;
+
     /// Buffer for earlier time steps exported to *.pvd file.
     std :: list< std :: string >pvdBuffer;
 
@@ -182,6 +211,7 @@ public:
 
     IRResultType initializeFrom(InputRecord *ir) override;
     void doOutput(TimeStep *tStep, bool forcedOutput = false) override;
+    std :: function< void() >doDeferredOutput(TimeStep *tStep, bool forcedOutput = false) override;
     void initialize() override;
     void terminate() override;
     const char *giveClassName() const override { return "VTKXMLExportModule"; }
@@ -190,9 +220,9 @@ public:
      */
     void exportPointDataHeader(FILE *fileStream, TimeStep *tStep);
     void giveDataHeaders(std :: string &pointHeader, std :: string &cellHeader); // returns the headers
-    /// Returns the internal smoother.
+    /// Returns the smoother (shared with other export modules, see Domain :: giveNodalRecoveryModel).
     NodalRecoveryModel *giveSmoother();
-    /// Returns the smoother for primary variables (nodal averaging).
+    /// Returns the smoother for primary variables (nodal averaging, shared with other export modules).
     NodalRecoveryModel *givePrimVarSmoother();
 
 
@@ -203,8 +233,6 @@ public:
 
     vtkSmartPointer< vtkDoubleArray >intVarArray;
     vtkSmartPointer< vtkDoubleArray >primVarArray;
-#else
-    FILE *fileStream;
 #endif
 
     VTKPiece defaultVTKPiece;
@@ -270,16 +298,16 @@ protected:
     //
 
     virtual void setupVTKPiece(VTKPiece &vtkPiece, TimeStep *tStep, int region);
-    void writeIntVars(VTKPiece &vtkPiece);
-    void writeXFEMVars(VTKPiece &vtkPiece);
-    void writePrimaryVars(VTKPiece &vtkPiece);
-    void writeCellVars(VTKPiece &vtkPiece);
-    void writeExternalForces(VTKPiece &vtkPiece);
+    void writeIntVars(VTKXMLFile &file, VTKPiece &vtkPiece);
+    void writeXFEMVars(VTKXMLFile &file, VTKPiece &vtkPiece);
+    void writePrimaryVars(VTKXMLFile &file, VTKPiece &vtkPiece);
+    void writeCellVars(VTKXMLFile &file, VTKPiece &vtkPiece);
+    void writeExternalForces(VTKXMLFile &file, VTKPiece &vtkPiece);
 
     /**
        @return true if piece is not empty and thus written
     */
-    bool writeVTKPiece(VTKPiece &vtkPiece, TimeStep *tStep);
+    bool writeVTKPiece(VTKXMLFile &file, VTKPiece &vtkPiece, TimeStep *tStep);
 
 
     void exportXFEMVarAs(XFEMStateType xfemstype, IntArray &mapG2L, IntArray &mapL2G, int regionDofMans, int ireg, TimeStep *tStep, EnrichmentItem *ei);
@@ -316,10 +344,21 @@ protected:
     virtual int initRegionNodeNumbering(IntArray &mapG2L, IntArray &mapL2G,
                                 int &regionDofMans, int &totalcells,
                                 Domain *domain, TimeStep *tStep, int reg);
+    /**
+     * Exports raw values in integration points (if required) and updates the VTK collection files.
+     * @param tStep Time step.
+     * @param writeCollection If false, the entries of given step are only added to the collection (pvdBuffer),
+     * the collection file is then written by writeVTKCollection once the vtu file exists.
+     */
+    void updateVTKCollections(TimeStep *tStep, bool writeCollection = true);
+    /// Returns the name of VTK collection file.
+    std :: string giveVTKCollectionFileName();
     /**
      * Writes a VTK collection file where time step data is stored.
+     * @param fname Name of collection file.
+     * @param entries Data set entries of the collection.
      */
-    void writeVTKCollection();
+    void writeVTKCollection(const std :: string &fname, const std :: list< std :: string > &entries);
     
     /// Writes a VTK collection file for Gauss points.
     void writeGPVTKCollection();
@@ -327,13 +366,49 @@ protected:
 #ifdef __VTK_MODULE
     void writeVTKPointData(const char *name, vtkSmartPointer< vtkDoubleArray >varArray);
 #else
-    void writeVTKPointData(FloatArray &valueArray);
+    void writeVTKPointData(VTKXMLFile &file, FloatArray &valueArray);
 #endif
 
 #ifdef __VTK_MODULE
     void writeVTKCellData(const char *name, vtkSmartPointer< vtkDoubleArray >varArray);
 #else
-    void writeVTKCellData(FloatArray &valueArray);
+    void writeVTKCellData(VTKXMLFile &file, FloatArray &valueArray);
+
+    /**
+     * Writes the header of data array. Its values are then written by writeFloat64, writeInt32 or writeUInt8
+     * (depending on type) and the array is closed by endDataArray.
+     * @param type VTK type name of values.
+     * @param name Array name, NULL if not named.
+     * @param ncomponents Number of components of array, not written if zero.
+     */
+    void beginDataArray(VTKXMLFile &file, const char *type, const char *name, int ncomponents);
+    void writeFloat64(VTKXMLFile &file, double value);
+    void writeInt32(VTKXMLFile &file, int value);
+    void writeUInt8(VTKXMLFile &file, int value);
+    /// Closes the data array, in appended formats finalizes (and possibly compresses) its binary block.
+    void endDataArray(VTKXMLFile &file);
+    /// Writes the appended data section (appended formats only).
+    void writeAppendedData(VTKXMLFile &file);
+
+    /// Writes the vtu file header (up to the first piece).
+    void writeVTKFileHeader(VTKXMLFile &file, double time);
+    /// Writes the end of vtu file (including appended data) and closes it.
+    void writeVTKFileFooter(VTKXMLFile &file);
+    /**
+     * Returns true if exported pieces can be set up first and written later, independently of the problem.
+     * Not supported for particle export and XFEM variables.
+     */
+    bool isOutputDeferrable();
+    /**
+     * Sets up the pieces of given step (a snapshot of exported data) and returns the task writing them to vtu file.
+     * The raw integration point values are written immediately, the VTK collection is written by the task after the vtu file.
+     */
+    std :: function< void() >giveOutputTask(TimeStep *tStep);
+    /**
+     * Writes the vtu file containing given pieces. Only the output settings of the receiver are used,
+     * so the file can be written while the receiver sets up the next step.
+     */
+    void writeVTKFile(const std :: string &fileName, double time, std :: vector< VTKPiece > &pieces);
 #endif
 
     // Export of composite elements (built up from several subcells)
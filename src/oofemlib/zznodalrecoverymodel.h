@@ -66,17 +66,33 @@ protected:
             lhs(a), rhs(b), regionNodalNumbers(c) { }
     };
 
+    /// Region data of ZZ recovery; they depend only on region geometry and are kept for all recoveries on it.
+    struct ZZRegion : public Region {
+        /// Lumped mass matrix of region (assembled from all elements supporting the recovery).
+        FloatArray mass;
+        /// Element contributions to lumped mass matrix, ordered as region elements (empty for unsupported elements).
+        std :: vector< FloatArray >elementMass;
+
+        ZZRegion() : Region(), mass(), elementMass() { }
+    };
+
 public:
     /// Constructor.
     ZZNodalRecoveryModel(Domain * d);
     /// Destructor.
     virtual ~ZZNodalRecoveryModel();
 
-    int recoverValues(Set elementSet, InternalStateType type, TimeStep *tStep) override;
-
     const char *giveClassName() const override { return "ZZNodalRecoveryModel"; }
 
+protected:
+    int recoverRegionValues(Set &elementSet, const std :: vector< InternalStateType > &types, TimeStep *tStep) override;
+    std :: unique_ptr< Region >createRegion() override { return std :: make_unique< ZZRegion >(); }
+    /// Computes the element contributions to lumped mass matrix of region.
+    void initRegion(Set &elementSet) override;
+
 private:
+    /// Assembles the lumped mass contribution of element at given position in region into lhs.
+    void assembleElementMass(FloatArray &lhs, int pos);
     /**
      * Initializes the region table indicating regions to skip.
      * @param regionMap Region table, the nonzero entry for region indicates region to skip due to
@@ -120,6 +136,7 @@ public:
     /**
      * Computes the element contribution to @f$\int_\Omega N^{\mathrm{T}} \cdot N\;\mathrm{d}\Omega @f$ term.
      * The size of answer should be [recordSize*numberofDofManagers].
+     * The term depends only on element geometry; it is evaluated once and reused until the region or mesh changes.
      * @param answer Contain diagonalized result.
      * @param type Determines the type of internal variable to be recovered.
      */
@@ -170,6 +170,15 @@ public:
     double computeIntegralThickWidth();
     MaterialMode giveCorrespondingSlaveMaterialMode(MaterialMode);
     GaussPoint *giveSlaveGaussPoint(GaussPoint *gp, int);
+    /**
+     * Computes the stresses of all fibers of given master point.
+     * Fibers sharing a material are evaluated in one batched call, see StructuralMaterial::giveRealStressVectors.
+     * @param answer Fiber stresses, one column per fiber.
+     * @param gp Master integration point.
+     * @param strain Generalized strain of the master point.
+     * @param tStep Current time step.
+     */
+    void giveFiberStresses(FloatMatrix &answer, GaussPoint *gp, const FloatArray &strain, TimeStep *tStep);
 
     void saveIPContext(DataStream &stream, ContextMode mode, GaussPoint *gp) override;
     void restoreIPContext(DataStream &stream, ContextMode mode, GaussPoint *gp) override;
@@ -219,6 +219,16 @@ public:
 
     MaterialMode giveCorrespondingSlaveMaterialMode(MaterialMode mode);
     GaussPoint *giveSlaveGaussPoint(GaussPoint *gp, int slaveIndex);
+    /**
+     * Computes the stresses of all layers of given master point.
+     * Layers sharing a material are evaluated in one batched call, see StructuralMaterial::giveRealStressVectors.
+     * Layer rotations are applied to the strains before and to the stresses after the evaluation.
+     * @param answer Layer stresses in element axes, one column per layer.
+     * @param gp Master integration point.
+     * @param strain Generalized strain of the master point.
+     * @param tStep Current time step.
+     */
+    void giveLayerStresses(FloatMatrix &answer, GaussPoint *gp, const FloatArray &strain, TimeStep *tStep);
 
     void saveIPContext(DataStream &stream, ContextMode mode, GaussPoint *gp) override;
     void restoreIPContext(DataStream &stream, ContextMode mode, GaussPoint *gp) override;
@@ -41,8 +41,16 @@
 #include "integrationdomain.h"
 #include "dofmantransftype.h"
 #include "floatarray.h"
+#include "floatmatrix.h"
+#include "statecountertype.h"
 
 #include <memory>
+#include <vector>
+
+///@name Input fields for StructuralElement
+//@{
+#define _IFT_StructuralElement_cachematrices "cachematrices"
+//@}
 
 namespace oofem {
 #define ALL_STRAINS -1
@@ -98,6 +106,24 @@ protected:
     /// Initial displacement vector, describes the initial nodal displacements when element has been casted.
     std :: unique_ptr< FloatArray >initialDisplacements;
 
+    /// Characteristic matrix stored in receiver's cache.
+    struct CachedMatrix {
+        CharType type;
+        MatResponseMode mode;
+        /// Domain model version the matrix has been computed for.
+        StateCounterType version;
+        FloatMatrix matrix;
+    };
+    /**
+     * Flag enabling the cache of characteristic matrices (stiffness and mass).
+     * Cached matrices are reused until the nodes move or material parameters change (see Domain::giveModelVersion),
+     * so the caching is valid only for linear problems (small strains, linear elastic material).
+     * It is switched off by checkConsistency for other materials.
+     */
+    bool cacheMatrices;
+    /// Cached characteristic matrices.
+    std :: vector< CachedMatrix >matrixCache;
+
 public:
     /**
      * Constructor. Creates structural element with given number, belonging to given domain.
@@ -109,6 +135,10 @@ public:
     virtual ~StructuralElement();
 
     void giveCharacteristicMatrix(FloatMatrix & answer, CharType, TimeStep * tStep) override;
+    /// Returns true if the characteristic matrices of receiver are cached.
+    bool hasCachedMatrices() const { return this->cacheMatrices; }
+    /// Drops all cached characteristic matrices of receiver.
+    void clearMatrixCache() { this->matrixCache.clear(); }
     void giveCharacteristicVector(FloatArray &answer, CharType type, ValueModeType mode, TimeStep *tStep) override;
 
     /**
@@ -47,6 +47,8 @@ class StructuralElement;
 class LastEquilibratedInternalForceAssembler : public InternalForceAssembler
 {
     void vectorFromElement(FloatArray &vec, Element &element, TimeStep *tStep, ValueModeType mode) const override;
+    /// Stored stresses are used, no evaluation of materials is needed.
+    void updateBeforeAssembly(Domain &domain, TimeStep *tStep) const override { }
 };
 
 /**
@@ -150,6 +150,9 @@ public:
 
     void updateBeforeNonlocAverage(const FloatArray &strainVector, GaussPoint *gp, TimeStep *tStep) override;
 
+    bool supportsInteractionTable() override { return true; }
+    double giveLocalVariableForAverage(GaussPoint *gp) override;
+
     /// Compute the factor that specifies how the interaction length should be modified (by eikonal nonlocal damage models)
     double giveNonlocalMetricModifierAt(GaussPoint *gp) override;
 
@@ -172,6 +175,7 @@ public:
      * receiver's associated integration point.
      */
     std :: vector< localIntegrationRecord > *NonlocalMaterialStiffnessInterface_giveIntegrationDomainList(GaussPoint *gp) override;
+    void NonlocalMaterialStiffnessInterface_giveInfluencingPoints(std :: vector< GaussPoint * > &answer, GaussPoint *gp) override;
     /**
      * Computes the "local" part of nonlocal stiffness contribution assembled for given integration point.
      * @param gp Source integration point.
@@ -62,14 +62,25 @@ class GaussPoint;
 class IsotropicDamageMaterialStatus : public StructuralMaterialStatus
 {
 protected:
-    /// Scalar measure of the largest strain level ever reached in material.
-    double kappa;
-    /// Non-equilibrated scalar measure of the largest strain level.
-    double tempKappa;
-    /// Damage level of material.
-    double damage;
-    /// Non-equilibrated damage level of material.
-    double tempDamage;
+    /**
+     * Indices of the scalar history variables in stateSlot: the largest strain level ever reached
+     * in material (kappa) and the damage level of material
+     * (and the densities of total stress work and dissipated work, if tracked).
+     */
+    enum StateVariable {
+        SV_Kappa,
+        SV_Damage,
+#ifdef keep_track_of_dissipated_energy
+        SV_StressWork,
+        SV_DissWork,
+#endif
+        SV_Count
+    };
+    /**
+     * Local storage of the scalar history variables, the equilibrated values followed by the temporary ones.
+     * Not used if the status is backed by integration point state store.
+     */
+    double stateValues [ 2 * SV_Count ];
     /**
      * Characteristic element length,
      * computed when damage initialized from direction of
@@ -81,17 +92,6 @@ protected:
     /// Crack orientation normalized to damage magnitude. This is useful for plotting cracks as a vector field (paraview etc.).
     FloatArray crackVector;
 
-#ifdef keep_track_of_dissipated_energy
-    /// Density of total work done by stresses on strain increments.
-    double stressWork;
-    /// Non-equilibrated density of total work done by stresses on strain increments.
-    double tempStressWork;
-    /// Density of dissipated work.
-    double dissWork;
-    /// Non-equilibrated density of dissipated work.
-    double tempDissWork;
-#endif
-
 public:
     /// Constructor
     IsotropicDamageMaterialStatus(GaussPoint *g);
@@ -101,17 +101,17 @@ public:
     void printOutputAt(FILE *file, TimeStep *tStep) override;
 
     /// Returns the last equilibrated scalar measure of the largest strain level.
-    double giveKappa() { return kappa; }
+    double giveKappa() { return stateSlot.giveConverged(SV_Kappa); }
     /// Returns the temp. scalar measure of the largest strain level.
-    double giveTempKappa() { return tempKappa; }
+    double giveTempKappa() { return stateSlot.giveTemp(SV_Kappa); }
     /// Sets the temp scalar measure of the largest strain level to given value.
-    void setTempKappa(double newKappa) { tempKappa = newKappa; }
+    void setTempKappa(double newKappa) { stateSlot.setTemp(SV_Kappa, newKappa); }
     /// Returns the last equilibrated damage level.
-    double giveDamage() { return damage; }
+    double giveDamage() { return stateSlot.giveConverged(SV_Damage); }
     /// Returns the temp. damage level.
-    double giveTempDamage() { return tempDamage; }
+    double giveTempDamage() { return stateSlot.giveTemp(SV_Damage); }
     /// Sets the temp damage level to given value.
-    void setTempDamage(double newDamage) { tempDamage = newDamage; }
+    void setTempDamage(double newDamage) { stateSlot.setTemp(SV_Damage, newDamage); }
 
     /// Returns characteristic length stored in receiver.
     double giveLe() { return le; }
@@ -128,17 +128,17 @@ public:
 
 #ifdef keep_track_of_dissipated_energy
     /// Returns the density of total work of stress on strain increments.
-    double giveStressWork() { return stressWork; }
+    double giveStressWork() { return stateSlot.giveConverged(SV_StressWork); }
     /// Returns the temp density of total work of stress on strain increments.
-    double giveTempStressWork() { return tempStressWork; }
+    double giveTempStressWork() { return stateSlot.giveTemp(SV_StressWork); }
     /// Sets the density of total work of stress on strain increments to given value.
-    void setTempStressWork(double w) { tempStressWork = w; }
+    void setTempStressWork(double w) { stateSlot.setTemp(SV_StressWork, w); }
     /// Returns the density of dissipated work.
-    double giveDissWork() { return dissWork; }
+    double giveDissWork() { return stateSlot.giveConverged(SV_DissWork); }
     /// Returns the density of temp dissipated work.
-    double giveTempDissWork() { return tempDissWork; }
+    double giveTempDissWork() { return stateSlot.giveTemp(SV_DissWork); }
     /// Sets the density of dissipated work to given value.
-    void setTempDissWork(double w) { tempDissWork = w; }
+    void setTempDissWork(double w) { stateSlot.setTemp(SV_DissWork, w); }
     /// Computes the increment of total stress work and of dissipated work.
     void computeWork(GaussPoint *gp);
 #endif
@@ -148,6 +148,8 @@ public:
     void initTempStatus() override;
     void updateYourself(TimeStep *tStep) override;
 
+    int giveNumberOfStateStoreVariables() const override { return SV_Count; }
+
     void saveContext(DataStream &stream, ContextMode mode) override;
     void restoreContext(DataStream &stream, ContextMode mode) override;
 };
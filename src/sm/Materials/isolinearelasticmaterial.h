@@ -46,6 +46,8 @@
 
 #include "MixedPressure/mixedpressurematerialextensioninterface.h"
 
+#include <limits>
+
 ///@name Input fields for IsotropicLinearElasticMaterial
 //@{
 #define _IFT_IsotropicLinearElasticMaterial_Name "isole"
@@ -105,6 +105,7 @@ public:
     void giveRealStressVector_2dBeamLayer(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep) override;
     void giveRealStressVector_PlateLayer(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep) override;
     void giveRealStressVector_Fiber(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep) override;
+    void giveRealStressVectors(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps, const FloatMatrix &reducedStrains, TimeStep *tStep) override;
 
     void giveEshelbyStressVector_PlaneStrain(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedF, TimeStep *tStep) override;
     double giveEnergyDensity(GaussPoint *gp, TimeStep *tStep);
@@ -60,8 +60,8 @@ namespace oofem {
 class M4MaterialStatus : public StructuralMaterialStatus
 {
 protected:
-    std::vector<MicroplaneState> microplaneStrain, tempMicroplaneStrain;
-    std::vector<MicroplaneState> microplaneStress, tempMicroplaneStress;
+    MicroplaneStates microplaneStrain, tempMicroplaneStrain;
+    MicroplaneStates microplaneStress, tempMicroplaneStress;
 
 public:
     M4MaterialStatus(GaussPoint *g, int nplanes);
@@ -72,13 +72,20 @@ public:
     void initTempStatus() override;
     void updateYourself(TimeStep *tStep) override;
 
-    const MicroplaneState &giveMicroplaneStrain(int mnumber) const { return microplaneStrain[mnumber-1]; }
-    const MicroplaneState &giveMicroplaneStress(int mnumber) const { return microplaneStress[mnumber-1]; }
+    MicroplaneState giveMicroplaneStrain(int mnumber) const { return microplaneStrain.at(mnumber); }
+    MicroplaneState giveMicroplaneStress(int mnumber) const { return microplaneStress.at(mnumber); }
 
-    const MicroplaneState &giveTempMicroplaneStress(int mnumber) const { return tempMicroplaneStress[mnumber-1]; }
+    MicroplaneState giveTempMicroplaneStress(int mnumber) const { return tempMicroplaneStress.at(mnumber); }
 
-    void letTempMicroplaneStrainBe(int mnumber, const MicroplaneState &state) { tempMicroplaneStrain[mnumber-1] = state; }
-    void letTempMicroplaneStressBe(int mnumber, const MicroplaneState &state) { tempMicroplaneStress[mnumber-1] = state; }
+    void letTempMicroplaneStrainBe(int mnumber, const MicroplaneState &state) { tempMicroplaneStrain.set(mnumber, state); }
+    void letTempMicroplaneStressBe(int mnumber, const MicroplaneState &state) { tempMicroplaneStress.set(mnumber, state); }
+
+    const MicroplaneStates &giveMicroplaneStrains() const { return microplaneStrain; }
+    const MicroplaneStates &giveMicroplaneStresses() const { return microplaneStress; }
+    MicroplaneStates &giveTempMicroplaneStresses() { return tempMicroplaneStress; }
+
+    void letTempMicroplaneStrainsBe(const MicroplaneStates &state) { tempMicroplaneStrain = state; }
+    void letTempMicroplaneStressesBe(const MicroplaneStates &state) { tempMicroplaneStress = state; }
 
     void saveContext(DataStream &stream, ContextMode mode) override;
     void restoreContext(DataStream &stream, ContextMode mode) override;
@@ -112,6 +119,7 @@ public:
     void giveThermalDilatationVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep) override;
 
     MicroplaneState giveRealMicroplaneStressVector(GaussPoint *gp, int mnumber, const MicroplaneState &strain, TimeStep *tStep) const override;
+    void giveRealMicroplaneStressVectors(MicroplaneStates &answer, GaussPoint *gp, const MicroplaneStates &strain, TimeStep *tStep) const override;
 
     static double FVplus(double ev, double k1, double c13, double c14, double c15, double Ev);
     static double FVminus(double ev, double k1, double k3, double k4, double E);
@@ -123,12 +131,20 @@ public:
               double c11, double c12, double Et);
 
     void updateVolumetricStressTo(GaussPoint *gp, int mnumber, double sigv) const override;
+    void updateVolumetricStressesTo(GaussPoint *gp, double sigv) const override;
 
     IRResultType initializeFrom(InputRecord *ir) override;
     const char *giveInputRecordName() const override { return _IFT_M4Material_Name; }
     const char *giveClassName() const override { return "M4Material"; }
 
 protected:
+    /**
+     * Evaluates the boundary curves of one microplane for given strain and the previous equilibrated state.
+     * Shared by the single plane and the batched evaluation.
+     */
+    MicroplaneState computeMicroplaneStress(const MicroplaneState &strain, const MicroplaneState &prevStrain,
+                                            const MicroplaneState &previousStress) const;
+
     MaterialStatus *CreateStatus(GaussPoint *gp) const override { return new M4MaterialStatus(gp, numberOfMicroplanes); }
 };
 } // end namespace oofem
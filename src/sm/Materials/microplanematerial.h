@@ -60,6 +60,40 @@ struct MicroplaneState
 };
 
 
+/**
+ * Defines the stress or strain states in all micro planes, stored as structure of arrays
+ * so that the microplane kernels run over contiguous arrays.
+ */
+struct MicroplaneStates
+{
+    FloatArray n;
+    FloatArray v;
+    FloatArray m;
+    FloatArray l;
+
+    MicroplaneStates() { }
+    MicroplaneStates(int nplanes) : n(nplanes), v(nplanes), m(nplanes), l(nplanes) { }
+
+    MicroplaneState at(int mnumber) const
+    {
+        MicroplaneState s;
+        s.n = n.at(mnumber);
+        s.v = v.at(mnumber);
+        s.m = m.at(mnumber);
+        s.l = l.at(mnumber);
+        return s;
+    }
+
+    void set(int mnumber, const MicroplaneState &s)
+    {
+        n.at(mnumber) = s.n;
+        v.at(mnumber) = s.v;
+        m.at(mnumber) = s.m;
+        l.at(mnumber) = s.l;
+    }
+};
+
+
 /**
  * Abstract base class for all microplane models.
  *
@@ -99,6 +133,13 @@ protected:
      */
     std::vector<FloatArrayF<6>> L;
 
+    /**
+     * Weighted projection tensors of all microplanes in structure of arrays layout,
+     * i.e. component i of the tensor for microplane p (multiplied by its integration weight) is stored at [ i * numberOfMicroplanes + p ].
+     * Used by the batched projection and homogenization kernels.
+     */
+    FloatArray NSoA, MSoA, LSoA, wNSoA, wMSoA, wLSoA;
+
     /// Young's modulus
     double E;
 
@@ -142,6 +183,29 @@ public:
      */
     MicroplaneState computeStrainVectorComponents(int mnumber, const FloatArray &macroStrain);
 
+    /**
+     * Computes the normal strain components of macro strain on all microplanes at once.
+     * @param answer Normal strains, one per microplane.
+     * @param macroStrain Macro strain in full Voigt form.
+     */
+    void computeNormalStrainComponents(FloatArray &answer, const FloatArray &macroStrain) const;
+    /**
+     * Computes all micro strain components (Ev, En, Em, El) of macro strain on all microplanes at once.
+     * @param answer Micro strains of all microplanes.
+     * @param macroStrain Macro strain in full Voigt form.
+     */
+    void computeStrainVectorComponents(MicroplaneStates &answer, const FloatArray &macroStrain) const;
+    /**
+     * Homogenizes the microplane stresses, i.e. integrates N sn + M sm + L sl over all microplanes
+     * (without the factor 6 from the integration over the unit hemisphere).
+     * Empty stress arrays are skipped.
+     * @param answer Macro stress in full Voigt form.
+     * @param sn Normal stresses on microplanes.
+     * @param sm Shear stresses in m direction on microplanes.
+     * @param sl Shear stresses in l direction on microplanes.
+     */
+    void homogenizeStressVector(FloatArray &answer, const FloatArray &sn, const FloatArray &sm, const FloatArray &sl) const;
+
 
     /**
      * Returns microplane integration weight.
@@ -72,6 +72,22 @@ public:
      */
     virtual void updateVolumetricStressTo(GaussPoint *gp, int mnumber, double sigv) const = 0;
 
+    /**
+     * Computes stresses on all microplanes at once.
+     * Default implementation calls giveRealMicroplaneStressVector for each microplane.
+     * @param answer Stresses on all microplanes.
+     * @param gp Integration point.
+     * @param strain Strains on all microplanes.
+     * @param tStep Time step.
+     */
+    virtual void giveRealMicroplaneStressVectors(MicroplaneStates &answer, GaussPoint *gp, const MicroplaneStates &strain, TimeStep *tStep) const;
+
+    /**
+     * Updates the volumetric stress component on all microplanes.
+     * Default implementation calls updateVolumetricStressTo for each microplane.
+     */
+    virtual void updateVolumetricStressesTo(GaussPoint *gp, double sigv) const;
+
     const char *giveClassName() const override { return "MicroplaneMaterial_Bazant"; }
 };
 } // end namespace oofem
@@ -131,6 +131,7 @@ public:
                                                               GaussPoint *gp, TimeStep *tStep) override;
 
     std :: vector< localIntegrationRecord > *NonlocalMaterialStiffnessInterface_giveIntegrationDomainList(GaussPoint *gp) override;
+    void NonlocalMaterialStiffnessInterface_giveInfluencingPoints(std :: vector< GaussPoint * > &answer, GaussPoint *gp) override;
 
     /**
      * Computes the "local" part of nonlocal stiffness contribution assembled for given integration point.
@@ -171,6 +172,10 @@ public:
 
     int hasBoundedSupport() override { return 1; }
 
+    bool supportsInteractionTable() override { return true; }
+    double giveLocalVariableForAverage(GaussPoint *gp) override
+    { return static_cast< RankineMatNlStatus * >( this->giveStatus(gp) )->giveLocalCumPlasticStrainForAverage(); }
+
     int giveIPValue(FloatArray &answer, GaussPoint *gp, InternalStateType type, TimeStep *tStep) override;
 
     int packUnknowns(DataStream &buff, TimeStep *tStep, GaussPoint *ip) override;
@@ -37,44 +37,74 @@
 
 #include "sm/Materials/structuralmaterial.h"
 #include "sm/Materials/structuralms.h"
+#include "statecountertype.h"
 
 #include <memory>
+#include <vector>
 
 ///@name Input fields for StructuralFE2Material
 //@{
 #define _IFT_StructuralFE2Material_Name "structfe2material"
 #define _IFT_StructuralFE2Material_fileName "filename"
 #define _IFT_StructuralFE2Material_useNumericalTangent "use_num_tangent"
+#define _IFT_StructuralFE2Material_batch "batch" ///< Solves the RVEs of all integration points concurrently before assembly
+#define _IFT_StructuralFE2Material_shared "shared" ///< Integration points share the RVE problems and store only their RVE state
 //@}
 
 namespace oofem {
 class EngngModel;
 class PrescribedGradientHomogenization;
+class StructuralFE2Material;
 
 class StructuralFE2MaterialStatus : public StructuralMaterialStatus
 {
 protected:
     /// The RVE
     std :: unique_ptr< EngngModel > rve;
+    /// Material providing the shared RVE problems, null if the receiver has its own RVE.
+    const StructuralFE2Material *sharedRVEMaterial;
+    /// Shared RVE problem holding the state of the receiver.
+    EngngModel *attachedRVE;
+    /// State of the shared RVE problem, converged in the last step.
+    std :: vector< char >rveState;
     /// Boundary condition in RVE that performs the computational homogenization.
     PrescribedGradientHomogenization *bc;
 
     FloatMatrix tangent;
     bool oldTangent;
 
+    /// Strain and solution state for which the RVE has been solved last (used in batch evaluation).
+    FloatArray solvedStrain;
+    StateCounterType solvedStateCounter;
+    /// Solution state in which the numerical tangent has been computed (used in batch evaluation).
+    StateCounterType tangentStateCounter;
+    /// True if the RVE has been solved last in its own time step (the tangent is then computed in the same step).
+    bool solvedInOwnTimeStep;
+
     /// Interface normal direction
     FloatArray mNormalDir;
 
     std :: string mInputFile;
 
 public:
-    StructuralFE2MaterialStatus(int rank, GaussPoint * g,  const std :: string & inputfile);
+    /**
+     * Constructor.
+     * @param rank Rank of the process (-1 if serial), used in the name of the RVE output.
+     * @param g Integration point.
+     * @param inputfile RVE input file.
+     * @param sharedRVEMaterial If given, the RVE problems of this material are used and only the state is stored in the receiver.
+     */
+    StructuralFE2MaterialStatus(int rank, GaussPoint * g,  const std :: string & inputfile, const StructuralFE2Material *sharedRVEMaterial = nullptr);
     virtual ~StructuralFE2MaterialStatus() {}
 
-    EngngModel *giveRVE() { return this->rve.get(); }
+    EngngModel *giveRVE() { return this->rve ? this->rve.get() : this->attachedRVE; }
     PrescribedGradientHomogenization *giveBC();// { return this->bc; }
 
     void markOldTangent();
+    /**
+     * Computes the tangent of the RVE in the time step of its last solution.
+     * @param tStep Macroscale time step.
+     */
     void computeTangent(TimeStep *tStep);
 
     /// Creates/Initiates the RVE problem.
@@ -83,8 +113,30 @@ public:
     /// Copies time step data to RVE.
     void setTimeStep(TimeStep *tStep);
 
+    /// Returns true if the RVE problem is shared with other integration points.
+    bool hasSharedRVE() const { return this->sharedRVEMaterial != nullptr; }
+    /// Restores the converged state of the receiver into the shared RVE problem of current thread.
+    void attachSharedRVE();
+    /**
+     * Solves the RVE for given macroscale strain and computes the homogenized stress.
+     * @param stress Homogenized stress.
+     * @param strain Macroscale strain.
+     * @param tStep Time step.
+     * @param ownTimeStep If true, the RVE is solved in its own time step, otherwise in tStep (always true for shared RVE).
+     */
+    void solveRVE(FloatArray &stress, const FloatArray &strain, TimeStep *tStep, bool ownTimeStep);
+
     FloatMatrix &giveTangent() { return tangent; }
 
+    /// Returns true if the RVE has been solved for given strain in current solution state of tStep.
+    bool isSolvedFor(const FloatArray &strain, TimeStep *tStep) const;
+    /// Records the strain and solution state for which the RVE has been solved.
+    void markSolved(const FloatArray &strain, TimeStep *tStep);
+    /// Returns true if the numerical tangent has been computed in current solution state of tStep.
+    bool hasTangentFor(TimeStep *tStep) const;
+    /// Records the solution state in which the numerical tangent has been computed.
+    void markTangentComputed(TimeStep *tStep);
+
     const char *giveClassName() const override { return "StructuralFE2MaterialStatus"; }
 
     void initTempStatus() override;
@@ -116,6 +168,16 @@ public:
  * - It must have a PrescribedGradient boundary condition.
  * - It must be the first boundary condition
  *
+ * In batch mode, the RVEs of all integration points are solved concurrently (each one by a single thread)
+ * before the internal forces or the tangent stiffness are assembled, and the elements are then given
+ * the stored results. The results are the same as when solved one after another.
+ *
+ * In shared mode, the integration points do not instantiate their own RVE problems. The mesh, the sparse
+ * matrix and the solver of one RVE problem per thread are shared, and each integration point only stores
+ * the state of the RVE (primary unknowns and material statuses) converged in the last step. The state is
+ * restored before each solution of the RVE, so every solution starts from the converged state.
+ * The temporary state is not stored, the last solution is repeated when the step is finished.
+ *
  * @author Mikael Öhman 
  */
 class StructuralFE2Material : public StructuralMaterial
@@ -124,6 +186,16 @@ protected:
     std :: string inputfile;
     static int n;
     bool useNumTangent;
+    /// Determines whether the RVEs are solved concurrently before assembly.
+    bool batchEvaluation;
+    /// Solution states in which the batch of stresses and tangents has been evaluated.
+    StateCounterType stressBatchStateCounter, tangentBatchStateCounter;
+    /// Determines whether the RVE problems are shared by integration points.
+    bool sharedRVE;
+    /// Shared RVE problems, one for each thread.
+    mutable std :: vector< std :: unique_ptr< EngngModel > >sharedRVEs;
+    /// Initial state of the shared RVE problems.
+    mutable std :: vector< char >initialRVEState;
 
 public:
     StructuralFE2Material(int n, Domain * d);
@@ -138,6 +210,26 @@ public:
     MaterialStatus *CreateStatus(GaussPoint *gp) const override;
     void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep) override;
     void give3dMaterialStiffnessMatrix(FloatMatrix &answer, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep) override;
+    void updateBeforeAssembly(TimeStep *tStep, bool tangent) override;
+
+    /// Returns the shared RVE problem of current thread, creating it if necessary.
+    EngngModel *giveSharedRVE() const;
+    /// Returns the initial state of the shared RVE problems.
+    const std :: vector< char > &giveInitialRVEState() const { return initialRVEState; }
+
+    /**
+     * Instantiates and initializes the RVE problem.
+     * @param inputfile RVE input file.
+     * @param name Suffix of the output file name.
+     * @param rank Rank of the process (-1 if serial).
+     */
+    static std :: unique_ptr< EngngModel > instanciateRVE(const std :: string &inputfile, const std :: string &name, int rank);
+
+protected:
+    /// Returns the rank of the process used in the RVE output names, -1 if serial.
+    int giveRVERank() const;
+    /// Computes the tangent by forward differences of stresses.
+    void computeNumericalTangent(FloatMatrix &answer, GaussPoint *gp, TimeStep *tStep);
 };
 
 } // end namespace oofem
@@ -48,6 +48,7 @@
 //@{
 #define _IFT_StructuralMaterial_referencetemperature "referencetemperature"
 #define _IFT_StructuralMaterial_talpha "talpha"
+#define _IFT_StructuralMaterial_ipstatestore "ipstatestore"
 //@}
 
 namespace oofem {
@@ -115,6 +116,11 @@ class StructuralMaterial : public Material
 protected:
     /// Reference temperature (temperature, when material has been built into structure).
     double referenceTemperature;
+    /**
+     * Flag determining whether the scalar history variables of statuses are kept in contiguous
+     * integration point state stores (one per element set), see Domain::giveIPStateStore.
+     */
+    bool ipStateStoreFlag;
 
 public:
     /// Voigt index map
@@ -141,6 +147,16 @@ public:
     IRResultType initializeFrom(InputRecord *ir) override;
     void giveInputRecord(DynamicInputRecord &input) override;
 
+    MaterialStatus *giveStatus(GaussPoint *gp) const override;
+    /**
+     * Attaches newly created status to the integration point state store of the material and element set of given integration point.
+     * Does nothing if the store is not requested or the status does not support it.
+     * Materials overloading giveStatus should call this for each created status.
+     * @param status Status to attach.
+     * @param gp Integration point of the status.
+     */
+    void initStateStore(MaterialStatus *status, GaussPoint *gp) const;
+
     /**
      * Computes the stiffness matrix for giveRealStressVector of receiver in given integration point, respecting its history.
      * The algorithm should use temporary or equilibrium  history variables stored in integration point status
@@ -170,6 +186,19 @@ public:
      */
     virtual void giveRealStressVector(FloatArray &answer, GaussPoint *gp,
                                       const FloatArray &reducedStrain, TimeStep *tStep);
+    /**
+     * Computes the real stress vectors for a batch of integration points of the same material mode,
+     * typically the layers or fibers of one cross section point.
+     * Strains and stresses are stored column-wise, so each point occupies one contiguous column.
+     * Default implementation calls the mode specific giveRealStressVector_* for each point, materials with a common tangent
+     * for all points may evaluate the whole batch at once.
+     * @param answer Stress vectors in reduced form, one column per point.
+     * @param gps Integration points, all sharing the same material mode.
+     * @param reducedStrains Strain vectors in reduced form, one column per point.
+     * @param tStep Current time step.
+     */
+    virtual void giveRealStressVectors(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps,
+                                       const FloatMatrix &reducedStrains, TimeStep *tStep);
     /// Default implementation relies on giveRealStressVector for second Piola-Kirchoff stress
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
     /// Default implementation relies on giveRealStressVector_3d
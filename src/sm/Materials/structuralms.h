@@ -38,6 +38,7 @@
 #include "matstatus.h"
 #include "floatarray.h"
 #include "matstatmapperint.h"
+#include "ipstatestore.h"
 
 namespace oofem {
 class GaussPoint;
@@ -87,6 +88,15 @@ protected:
     /// Temporary deformation gradient in reduced form (to find balanced state)
     FloatArray tempFVector;
 
+    /// Integration point state store keeping the scalar history variables (NULL if not used).
+    IPStateStore *stateStore;
+    /**
+     * Handle of the scalar history variables of derived status, see giveNumberOfStateStoreVariables.
+     * Refers either to the state store, or to the local storage of derived status.
+     * The variables are updated by receiver.
+     */
+    IPStateStore :: Slot stateSlot;
+
 public:
     /// Constructor. Creates new StructuralMaterialStatus with IntegrationPoint g.
     StructuralMaterialStatus(GaussPoint * g);
@@ -101,6 +111,20 @@ public:
     void saveContext(DataStream &stream, ContextMode mode) override;
     void restoreContext(DataStream &stream, ContextMode mode) override;
 
+    /**
+     * Returns the number of scalar history variables of receiver, which can be kept in integration point state store.
+     * Derived statuses supporting the store access these variables through stateSlot.
+     * @return Number of variables, zero if the store is not supported.
+     */
+    virtual int giveNumberOfStateStoreVariables() const { return 0; }
+    /**
+     * Moves the scalar history variables of receiver into new slot of given store.
+     * @param store Store with giveNumberOfStateStoreVariables variables per slot.
+     */
+    void setStateStore(IPStateStore *store);
+    /// Returns the state store backing the receiver (NULL if not used).
+    IPStateStore *giveStateStore() const { return stateStore; }
+
     /// Returns the const pointer to receiver's strain vector.
     const FloatArray &giveStrainVector() const { return strainVector; }
     /// Returns the const pointer to receiver's stress vector.
@@ -0,0 +1,14 @@
+#
+# this test checks the binary input format: text input is converted to binary one, which is then solved
+#
+set -e
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+echo "Command: $OOFEM -f patch302_renumbering.in -wb patch302_renumbering.bin"
+# convert text input to binary one, error checking rules are kept in binary file
+$OOFEM -f patch302_renumbering.in -wb patch302_renumbering.bin
+echo "Command: $OOFEM -f patch302_renumbering.bin"
+# solve binary input and check the results
+$OOFEM -f patch302_renumbering.bin
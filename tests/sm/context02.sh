@@ -0,0 +1,16 @@
+#
+# this test checks restart from differential context
+#
+set -e
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+echo "Command: $OOFEM -f context02.in.0"
+# run target on input and store contexts, full one in step 2, differential ones in steps 3 and 4
+$OOFEM -f context02.in.0
+# context of step 3 has to be differential, thus smaller than the full one
+test $(wc -c < context02.out.0.3.0.osf) -lt $(wc -c < context02.out.0.2.0.osf)
+echo "Command: $OOFEM -f context02.in.0 -r 3"
+# run target on the same file, but restarting from differential context of step 3
+$OOFEM -f context02.in.0 -r 3